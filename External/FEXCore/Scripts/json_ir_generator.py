@@ -4,7 +4,7 @@ import sys
 # Print out enum values
 def print_enums(ops, defines):
     output_file.write("#ifdef IROP_ENUM\n")
-    output_file.write("enum IROps : uint8_t {\n")
+    output_file.write("enum IROps : uint16_t {\n")
 
     for op_key, op_vals in ops.items():
         output_file.write("\t\tOP_%s,\n" % op_key.upper())
@@ -7,7 +7,10 @@
 #include <FEXCore/Config/Config.h>
 #include <filesystem>
 #include <map>
+#include <optional>
+#include <string_view>
 #include <sys/sysinfo.h>
+#include <vector>
 
 namespace FEXCore::Config {
   std::string GetDataDirectory() {
@@ -109,8 +112,9 @@ namespace FEXCore::Config {
   static std::map<FEXCore::Config::LayerType, std::unique_ptr<FEXCore::Config::Layer>> ConfigLayers;
   static FEXCore::Config::Layer *Meta{};
 
-  constexpr std::array<FEXCore::Config::LayerType, 6> LoadOrder = {
+  constexpr std::array<FEXCore::Config::LayerType, 7> LoadOrder = {
     FEXCore::Config::LayerType::LAYER_MAIN,
+    FEXCore::Config::LayerType::LAYER_PROFILE,
     FEXCore::Config::LayerType::LAYER_GLOBAL_APP,
     FEXCore::Config::LayerType::LAYER_LOCAL_APP,
     FEXCore::Config::LayerType::LAYER_ARGUMENTS,
@@ -204,6 +208,55 @@ namespace FEXCore::Config {
     }
   }
 
+  struct ProfileOption {
+    ConfigOption Option;
+    const char *Value;
+  };
+
+  // Curated relaxations that are safe for the class of application each profile is named after
+  // These only ever loosen emulation guarantees, so anything selecting them must be a known-good workload
+  static const std::map<std::string_view, std::vector<ProfileOption>, std::less<>> PerfProfiles = {
+    {"singlethreaded", {
+      {CONFIG_TSOENABLED, "0"},
+      {CONFIG_PARANOIDTSO, "0"},
+    }},
+    {"compiled", {
+      {CONFIG_ABILOCALFLAGS, "1"},
+      {CONFIG_ABINOPF, "1"},
+    }},
+    {"staticcode", {
+      {CONFIG_SMCCHECKS, "0"}, // CONFIG_SMC_NONE
+      {CONFIG_MULTIBLOCK, "1"},
+    }},
+    {"all", {
+      {CONFIG_TSOENABLED, "0"},
+      {CONFIG_PARANOIDTSO, "0"},
+      {CONFIG_ABILOCALFLAGS, "1"},
+      {CONFIG_ABINOPF, "1"},
+      {CONFIG_SMCCHECKS, "0"}, // CONFIG_SMC_NONE
+      {CONFIG_MULTIBLOCK, "1"},
+    }},
+  };
+
+  class ProfileLayer final : public FEXCore::Config::Layer {
+  public:
+    ProfileLayer(std::vector<ProfileOption> const *_Options)
+      : FEXCore::Config::Layer (FEXCore::Config::LayerType::LAYER_PROFILE)
+      , Options {_Options} {
+    }
+    ~ProfileLayer() {
+    }
+    void Load() override {
+      OptionMap.clear();
+      for (auto &Option : *Options) {
+        Set(Option.Option, Option.Value);
+      }
+    }
+
+  private:
+    std::vector<ProfileOption> const *Options;
+  };
+
   void Initialize() {
     AddLayer(std::make_unique<MetaLayer>(FEXCore::Config::LayerType::LAYER_TOP));
     Meta = ConfigLayers.begin()->second.get();
@@ -252,7 +305,42 @@ namespace FEXCore::Config {
     return {};
   }
 
+  // The profile is selected by the layers that sit above it, so look it up in them directly rather than through the meta layer
+  static std::optional<std::string> FindProfileName() {
+    for (auto CurrentLayer = LoadOrder.rbegin(); CurrentLayer != LoadOrder.rend(); ++CurrentLayer) {
+      if (*CurrentLayer == FEXCore::Config::LayerType::LAYER_TOP ||
+          *CurrentLayer == FEXCore::Config::LayerType::LAYER_PROFILE) {
+        continue;
+      }
+
+      auto it = ConfigLayers.find(*CurrentLayer);
+      if (it != ConfigLayers.end()) {
+        if (auto Value = it->second->Get(FEXCore::Config::CONFIG_PERFPROFILE)) {
+          return **Value;
+        }
+      }
+    }
+
+    return std::nullopt;
+  }
+
   void ReloadMetaLayer() {
+    // Drop the previous profile first so that clearing or mistyping it doesn't leave its options behind
+    ConfigLayers.erase(FEXCore::Config::LayerType::LAYER_PROFILE);
+
+    auto ProfileName = FindProfileName();
+    if (ProfileName && !ProfileName->empty()) {
+      auto Profile = PerfProfiles.find(*ProfileName);
+      if (Profile != PerfProfiles.end()) {
+        auto Layer = std::make_unique<ProfileLayer>(&Profile->second);
+        Layer->Load();
+        AddLayer(std::move(Layer));
+      }
+      else {
+        LogMan::Msg::E("Unknown performance profile: '%s'", ProfileName->c_str());
+      }
+    }
+
     Meta->Load();
 
     // Do configuration option fix ups after everything is reloaded
@@ -54,6 +54,14 @@ namespace FEXCore::Context {
     CTX->Step();
   }
 
+  void AddBreakpoint(FEXCore::Context::Context *CTX, uint64_t RIP) {
+    CTX->AddBreakpoint(RIP);
+  }
+
+  void RemoveBreakpoint(FEXCore::Context::Context *CTX, uint64_t RIP) {
+    CTX->RemoveBreakpoint(RIP);
+  }
+
   void CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
     Thread->CTX->CompileBlock(Thread->CurrentFrame, GuestRIP);
   }
@@ -171,6 +179,9 @@ namespace FEXCore::Context {
   void RemoveNamedRegion(FEXCore::Context::Context *CTX, uintptr_t Base, uintptr_t Length) {
     return CTX->RemoveNamedRegion(Base, Length);
   }
+  void NotifyGuestMappingChanged(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length) {
+    CTX->NotifyGuestMappingChanged(Start, Length);
+  }
 
 namespace Debug {
   void CompileRIP(FEXCore::Context::Context *CTX, uint64_t RIP) {
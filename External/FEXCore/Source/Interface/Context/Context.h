@@ -98,6 +98,7 @@ namespace FEXCore::Context {
   #endif
 
     friend class FEXCore::IR::Validation::IRValidation;
+    friend class FEXCore::BlockSamplingData;
 
     struct {
       CoreRunningMode RunningMode {CoreRunningMode::MODE_RUN};
@@ -122,7 +123,9 @@ namespace FEXCore::Context {
       FEX_CONFIG_OPT(RootFSPath, ROOTFS);
       FEX_CONFIG_OPT(ThunkHostLibsPath, THUNKHOSTLIBS);
       FEX_CONFIG_OPT(DumpIR, DUMPIR);
+      FEX_CONFIG_OPT(BlockStats, BLOCKSTATS);
       FEX_CONFIG_OPT(StaticRegisterAllocation, SRA);
+      FEX_CONFIG_OPT(Deterministic, DETERMINISTIC);
     } Config;
 
     using IntCallbackReturn =  FEX_NAKED void(*)(FEXCore::Core::InternalThreadState *Thread, volatile void *Host_RSP);
@@ -131,6 +134,8 @@ namespace FEXCore::Context {
     FEXCore::HostFeatures HostFeatures;
 
     std::mutex ThreadCreationMutex;
+    // Serializes CompileBlock across threads in deterministic mode
+    std::recursive_mutex DeterministicCompileMutex;
     uint64_t ThreadID{};
     FEXCore::Core::InternalThreadState* ParentThread;
     std::vector<FEXCore::Core::InternalThreadState*> Threads;
@@ -174,9 +179,8 @@ namespace FEXCore::Context {
     std::map<uint64_t, AddrToFileEntry> AddrToFile;
     std::map<std::string, std::string> FilesWithCode;
 
-#ifdef BLOCKSTATS
+    // Only allocated when block stats are enabled
     std::unique_ptr<FEXCore::BlockSamplingData> BlockData;
-#endif
 
     SignalDelegator *SignalDelegation{};
     X86GeneratedCode X86CodeGen;
@@ -211,6 +215,9 @@ namespace FEXCore::Context {
       RemoveCodeEntry(Frame->Thread, GuestRIP);
     }
 
+    // Called by the DebugBreakpoint IR op. Returns once the debugger resumes execution
+    static void HandleDebugBreakpoint(FEXCore::Core::CpuStateFrame *Frame);
+
     // Debugger interface
     void CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
     uint64_t GetThreadCount() const;
@@ -218,6 +225,33 @@ namespace FEXCore::Context {
     bool GetDebugDataForRIP(uint64_t RIP, FEXCore::Core::DebugData *Data);
     bool FindHostCodeForRIP(uint64_t RIP, uint8_t **Code);
 
+    // Debugger breakpoints
+    // Only modified while the guest is paused
+    void AddBreakpoint(uint64_t RIP);
+    void RemoveBreakpoint(uint64_t RIP);
+    bool HasBreakpoints();
+
+    /**
+     * @brief Stops every other thread and reports the debug stop to the exit handler
+     *
+     * @param Thread The thread that stopped, it must already be idle
+     * @param WatchpointStop The stop came from a fault on a watched page, which might not need reporting
+     */
+    void NotifyDebugStop(FEXCore::Core::InternalThreadState *Thread, bool WatchpointStop = false);
+
+    /**
+     * @name Debugger watchpoints
+     *
+     * Watched pages are protected, so the host accessing them for the guest would fault: syscalls return EFAULT and
+     * signal frames can't be written. These open the pages up for the duration of the access.
+     * Like hardware watchpoints, accesses by the kernel aren't reported.
+     * @{ */
+    void SuspendWatchpoints();
+    void ResumeWatchpoints();
+    /**  @} */
+    // The guest changed the mapping or protection of a range
+    void NotifyGuestMappingChanged(uint64_t Start, uint64_t Length);
+
     struct GenerateIRResult {
       FEXCore::IR::IRListView* IRList;
       // User's responsibility to deallocate this.
@@ -280,7 +314,8 @@ namespace FEXCore::Context {
   private:
     void WaitForIdleWithTimeout();
 
-    void NotifyPause();
+    void NotifyPause(FEXCore::Core::InternalThreadState *IgnoreThread = nullptr);
+    void InvalidateCodeForBreakpoint(uint64_t RIP);
 
     void AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr, uint64_t Start, uint64_t Length);
     FEXCore::CodeLoader *LocalLoader{};
@@ -290,6 +325,11 @@ namespace FEXCore::Context {
     std::mutex ExitMutex;
     std::unique_ptr<GdbServer> DebugServer;
 
+    std::shared_mutex BreakpointLock;
+    std::set<uint64_t> Breakpoints;
+    // Set by the first thread to report a debug stop, so only one stop is reported per resume
+    std::atomic_bool DebugStopReported{};
+
     std::shared_mutex AOTIRCacheLock;
     std::shared_mutex AOTIRCaptureCacheWriteoutLock;
     std::atomic<bool> AOTIRCaptureCacheWriteoutFlusing;
@@ -1,3 +1,4 @@
+#include "Interface/Context/Context.h"
 #include "Interface/Core/ArchHelpers/Arm64Emitter.h"
 
 #include <FEXCore/Utils/LogManager.h>
@@ -9,15 +10,14 @@ namespace FEXCore::CPU {
 #define STATE x28
 
 // We want vixl to not allocate a default buffer. Jit and dispatcher will manually create one.
-Arm64Emitter::Arm64Emitter(size_t size) : vixl::aarch64::Assembler(size, vixl::aarch64::PositionDependentCode) {
+Arm64Emitter::Arm64Emitter(FEXCore::Context::Context *ctx, size_t size) : vixl::aarch64::Assembler(size, vixl::aarch64::PositionDependentCode) {
   CPU.SetUp();
 
+  // vixl still gets everything the host has, the flags decide what gets emitted
   auto Features = vixl::CPUFeatures::InferFromOS();
-  SupportsAtomics = Features.Has(vixl::CPUFeatures::Feature::kAtomics);
-  // RCPC is bugged on Snapdragon 865
-  // Causes glibc cond16 test to immediately throw assert
-  // __pthread_mutex_cond_lock: Assertion `mutex->__data.__owner == 0'
-  SupportsRCPC = false; //Features.Has(vixl::CPUFeatures::Feature::kRCpc);
+  SupportsAtomics = ctx->HostFeatures.SupportsAtomics;
+  SupportsRCPC = ctx->HostFeatures.SupportsRCPC;
+  SupportsRCPCImm = ctx->HostFeatures.SupportsTSOImm9;
 
   if (SupportsAtomics) {
     // Hypervisor can hide this on the c630?
@@ -4,6 +4,10 @@
 #include "aarch64/cpu-aarch64.h"
 #include "FEXCore/Config/Config.h"
 
+namespace FEXCore::Context {
+  struct Context;
+}
+
 namespace FEXCore::CPU {
 using namespace vixl;
 using namespace vixl::aarch64;
@@ -50,11 +54,12 @@ const std::array<aarch64::VRegister, 12> RAFPR = {
 // be used by both Arm64 JIT and ARM64 Dispatcher
 class Arm64Emitter : public vixl::aarch64::Assembler {
 protected:
-  Arm64Emitter(size_t size);
+  Arm64Emitter(FEXCore::Context::Context *ctx, size_t size);
 
   vixl::aarch64::CPU CPU;
   bool SupportsAtomics{};
   bool SupportsRCPC{};
+  bool SupportsRCPCImm{};
 
   void LoadConstant(vixl::aarch64::Register Reg, uint64_t Constant);
   void SpillStaticRegs();
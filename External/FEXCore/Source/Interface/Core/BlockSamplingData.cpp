@@ -1,51 +1,265 @@
+#include "Interface/Context/Context.h"
 #include "Interface/Core/BlockSamplingData.h"
+#include <FEXCore/Utils/Allocator.h>
 #include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
 #include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <fmt/format.h>
 #include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
 
 namespace FEXCore {
-  void BlockSamplingData::DumpBlockData() {
-    std::fstream Output;
-    Output.open("output.csv", std::fstream::out | std::fstream::binary);
+namespace {
+  // Just enough of an ELF to turn a file offset in to a function name
+  class SymbolTable {
+  public:
+    explicit SymbolTable(std::string const &Filename);
+
+    std::optional<std::string> Lookup(uint64_t FileOffset) const;
+
+  private:
+    struct Segment {
+      uint64_t Offset;
+      uint64_t Size;
+      uint64_t VAddr;
+    };
+
+    struct Symbol {
+      uint64_t Size;
+      std::string Name;
+    };
+
+    template<typename Ehdr, typename Phdr, typename Shdr, typename Sym>
+    void Load(uint8_t const *Data, size_t Size);
+
+    std::vector<Segment> Segments;
+    std::map<uint64_t, Symbol> Symbols;
+  };
+
+  SymbolTable::SymbolTable(std::string const &Filename) {
+    int FD = open(Filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (FD == -1) {
+      return;
+    }
+
+    struct stat Stat{};
+    if (fstat(FD, &Stat) == -1 || static_cast<size_t>(Stat.st_size) < EI_NIDENT) {
+      close(FD);
+      return;
+    }
+
+    size_t Size = Stat.st_size;
+    auto Data = reinterpret_cast<uint8_t const*>(FEXCore::Allocator::mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, FD, 0));
+    close(FD);
+
+    if (Data == MAP_FAILED) {
+      return;
+    }
+
+    if (memcmp(Data, ELFMAG, SELFMAG) == 0) {
+      if (Data[EI_CLASS] == ELFCLASS64 && Size >= sizeof(Elf64_Ehdr)) {
+        Load<Elf64_Ehdr, Elf64_Phdr, Elf64_Shdr, Elf64_Sym>(Data, Size);
+      }
+      else if (Data[EI_CLASS] == ELFCLASS32 && Size >= sizeof(Elf32_Ehdr)) {
+        Load<Elf32_Ehdr, Elf32_Phdr, Elf32_Shdr, Elf32_Sym>(Data, Size);
+      }
+    }
 
-    if (!Output.is_open())
+    FEXCore::Allocator::munmap(const_cast<uint8_t*>(Data), Size);
+  }
+
+  template<typename Ehdr, typename Phdr, typename Shdr, typename Sym>
+  void SymbolTable::Load(uint8_t const *Data, size_t Size) {
+    auto Header = reinterpret_cast<Ehdr const*>(Data);
+
+    if ((Header->e_phoff + Header->e_phnum * sizeof(Phdr)) > Size ||
+        (Header->e_shoff + Header->e_shnum * sizeof(Shdr)) > Size) {
       return;
+    }
+
+    auto Phdrs = reinterpret_cast<Phdr const*>(Data + Header->e_phoff);
+    for (size_t i = 0; i < Header->e_phnum; ++i) {
+      if (Phdrs[i].p_type == PT_LOAD) {
+        Segments.emplace_back(Segment{Phdrs[i].p_offset, Phdrs[i].p_filesz, Phdrs[i].p_vaddr});
+      }
+    }
+
+    auto Shdrs = reinterpret_cast<Shdr const*>(Data + Header->e_shoff);
+
+    // Prefer the full symbol table, stripped binaries only have the dynamic one
+    for (auto Type : {SHT_SYMTAB, SHT_DYNSYM}) {
+      for (size_t i = 0; i < Header->e_shnum; ++i) {
+        auto &Section = Shdrs[i];
+        if (Section.sh_type != Type ||
+            Section.sh_link >= Header->e_shnum ||
+            (Section.sh_offset + Section.sh_size) > Size) {
+          continue;
+        }
+
+        auto &Strings = Shdrs[Section.sh_link];
+        if ((Strings.sh_offset + Strings.sh_size) > Size) {
+          continue;
+        }
+
+        auto Syms = reinterpret_cast<Sym const*>(Data + Section.sh_offset);
+        auto StrData = reinterpret_cast<char const*>(Data + Strings.sh_offset);
+
+        for (size_t j = 0; j < Section.sh_size / sizeof(Sym); ++j) {
+          auto &Symbol = Syms[j];
+          if ((Symbol.st_info & 0xF) != STT_FUNC ||
+              Symbol.st_value == 0 ||
+              Symbol.st_name >= Strings.sh_size) {
+            continue;
+          }
 
-    Output << "Entry, Min, Max, Total, Calls, Average" << std::endl;
+          auto Name = StrData + Symbol.st_name;
+          Symbols.try_emplace(Symbol.st_value, SymbolTable::Symbol{Symbol.st_size, std::string(Name, strnlen(Name, Strings.sh_size - Symbol.st_name))});
+        }
+      }
 
-    for (auto it : SamplingMap) {
-      if (!it.second->TotalCalls)
+      if (!Symbols.empty()) {
+        break;
+      }
+    }
+  }
+
+  std::optional<std::string> SymbolTable::Lookup(uint64_t FileOffset) const {
+    for (auto &Segment : Segments) {
+      if (FileOffset < Segment.Offset || FileOffset >= (Segment.Offset + Segment.Size)) {
         continue;
+      }
+
+      uint64_t VAddr = FileOffset - Segment.Offset + Segment.VAddr;
+      auto it = Symbols.upper_bound(VAddr);
+      if (it == Symbols.begin()) {
+        return std::nullopt;
+      }
+      --it;
 
-      Output << "0x" << std::hex << it.first
-             << ", " << std::dec << it.second->Min
-             << ", " << std::dec << it.second->Max
-             << ", " << std::dec << it.second->TotalTime
-             << ", " << std::dec << it.second->TotalCalls
-             << ", " << std::dec << ((double)it.second->TotalTime / (double)it.second->TotalCalls)
-             << std::endl;
+      // Some hand written asm has no size, give it the benefit of the doubt
+      if (it->second.Size && VAddr >= (it->first + it->second.Size)) {
+        return std::nullopt;
+      }
+
+      return fmt::format("{}+0x{:x}", it->second.Name, VAddr - it->first);
     }
-    Output.close();
-    LogMan::Msg::D("Dumped %d blocks of sampling data", SamplingMap.size());
+    return std::nullopt;
   }
+}
 
-  BlockSamplingData::BlockData *BlockSamplingData::GetBlockData(uint64_t RIP) {
-    auto it = SamplingMap.find(RIP);
-    if (it != SamplingMap.end()) {
-      return it->second;
-    }
-    BlockData *NewData = new BlockData{};
-    memset(NewData, 0, sizeof(BlockData));
-    NewData->Min = ~0ULL;
-    SamplingMap[RIP] = NewData;
-    return NewData;
+  BlockSamplingData::BlockSamplingData(FEXCore::Context::Context *CTX, std::string const &Output)
+    : CTX {CTX}
+    , Output {Output} {
   }
 
-  BlockSamplingData::~BlockSamplingData() {
-    DumpBlockData();
-    for (auto it : SamplingMap) {
-      delete it.second;
+  void BlockSamplingData::DumpBlockData() {
+    struct Totals {
+      uint64_t RIP;
+      uint64_t Min{~0ULL}, Max{};
+      uint64_t TotalTime{};
+      uint64_t TotalCalls{};
+    };
+
+    std::vector<Totals> Blocks;
+    {
+      std::unordered_map<uint64_t, size_t> Lookup;
+      std::lock_guard lk(SamplingLock);
+
+      for (auto &Data : SamplingData) {
+        if (!Data.TotalCalls) {
+          continue;
+        }
+
+        auto [it, Inserted] = Lookup.try_emplace(Data.RIP, Blocks.size());
+        if (Inserted) {
+          Blocks.emplace_back(Totals{.RIP = Data.RIP});
+        }
+
+        auto &Block = Blocks[it->second];
+        Block.Min = std::min(Block.Min, Data.Min);
+        Block.Max = std::max(Block.Max, Data.Max);
+        Block.TotalTime += Data.TotalTime;
+        Block.TotalCalls += Data.TotalCalls;
+      }
+    }
+
+    std::sort(Blocks.begin(), Blocks.end(), [](Totals const &a, Totals const &b) {
+      return a.TotalTime > b.TotalTime;
+    });
+
+    std::ofstream FileOutput;
+    std::ostream *Stream{};
+    if (Output == "stdout") {
+      Stream = &std::cout;
     }
-    SamplingMap.clear();
+    else if (Output == "stderr") {
+      Stream = &std::cerr;
+    }
+    else {
+      FileOutput.open(Output, std::ios::out | std::ios::trunc);
+      if (!FileOutput.is_open()) {
+        LogMan::Msg::EFmt("Couldn't open block stats output: {}", Output);
+        return;
+      }
+      Stream = &FileOutput;
+    }
+
+    std::unordered_map<std::string, std::unique_ptr<SymbolTable>> SymbolTables;
+    std::shared_lock lk(CTX->AOTIRCacheLock);
+
+    *Stream << "Entry, Calls, Total, Min, Max, Average, Symbol" << std::endl;
+
+    for (auto &Block : Blocks) {
+      std::string Symbol;
+
+      auto File = CTX->AddrToFile.upper_bound(Block.RIP);
+      if (File != CTX->AddrToFile.begin()) {
+        --File;
+        auto &Entry = File->second;
+
+        if (Block.RIP < (Entry.Start + Entry.Len)) {
+          uint64_t FileOffset = Block.RIP - Entry.Start + Entry.Offset;
+
+          auto &Table = SymbolTables[Entry.filename];
+          if (!Table) {
+            Table = std::make_unique<SymbolTable>(Entry.filename);
+          }
+
+          auto Name = Table->Lookup(FileOffset);
+          Symbol = fmt::format("{}!{}", std::filesystem::path(Entry.filename).filename().string(), Name ? *Name : fmt::format("0x{:x}", FileOffset));
+        }
+      }
+
+      *Stream << fmt::format("0x{:x}, {}, {}, {}, {}, {:.2f}, {}",
+        Block.RIP,
+        Block.TotalCalls,
+        Block.TotalTime,
+        Block.Min,
+        Block.Max,
+        static_cast<double>(Block.TotalTime) / static_cast<double>(Block.TotalCalls),
+        Symbol) << std::endl;
+    }
+
+    LogMan::Msg::DFmt("Dumped {} blocks of sampling data", Blocks.size());
+  }
+
+  BlockSamplingData::BlockData *BlockSamplingData::GetBlockData(uint64_t RIP) {
+    std::lock_guard lk(SamplingLock);
+    auto &NewData = SamplingData.emplace_back(BlockData{});
+    NewData.Min = ~0ULL;
+    NewData.RIP = RIP;
+    return &NewData;
   }
 }
@@ -1,23 +1,52 @@
 #pragma once
-#include <unordered_map>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
 #include <stdint.h>
 
+namespace FEXCore::Context {
+  struct Context;
+}
+
 namespace FEXCore {
+/**
+ * @brief Exact per-block execution counts and timings, enabled with the BlockStats config option
+ *
+ * Every compiled block gets its own record that the JIT code updates directly.
+ * A block's code is only ever run by the thread that compiled it, so the counters don't need atomics.
+ * Records of the same guest RIP (other threads, recompiles) are merged when the report is written.
+ */
 class BlockSamplingData {
 public:
   struct BlockData {
-    uint64_t Start, End;
+    uint64_t Start;
     uint64_t Min, Max;
     uint64_t TotalTime;
     uint64_t TotalCalls;
+    uint64_t RIP;
   };
 
+  // The backends load and store these in pairs
+  static_assert(offsetof(BlockData, Max) == offsetof(BlockData, Min) + 8);
+  static_assert(offsetof(BlockData, TotalCalls) == offsetof(BlockData, TotalTime) + 8);
+
+  // Output is stdout, stderr or a file path
+  BlockSamplingData(FEXCore::Context::Context *CTX, std::string const &Output);
+
   BlockData *GetBlockData(uint64_t RIP);
-  ~BlockSamplingData();
 
+  /**
+   * @brief Writes out the blocks sorted by total time, with the guest symbol they belong to
+   */
   void DumpBlockData();
 
 private:
-  std::unordered_map<uint64_t, BlockData*> SamplingMap;
+  FEXCore::Context::Context *CTX;
+  std::string Output;
+
+  std::mutex SamplingLock;
+  // deque so records never move once the JIT has baked their address in to code
+  std::deque<BlockData> SamplingData;
 };
 }
@@ -1,6 +1,6 @@
 #pragma once
-#include <functional>
-#include <unordered_map>
+#include <algorithm>
+#include <array>
 
 #include <FEXCore/Core/CPUID.h>
 #include <FEXCore/Config/Config.h>
@@ -25,24 +25,98 @@ public:
   void Init(FEXCore::Context::Context *ctx);
 
   FEXCore::CPUID::FunctionResults RunFunction(uint32_t Function, uint32_t Leaf) {
-    auto Handler = FunctionHandlers.find(Function);
+    auto Entry = GetFunctionEntry(Function);
 
-    if (Handler == FunctionHandlers.end()) {
-      return Function_Reserved(Leaf);
+    if (!Entry || !Entry->Handler) {
+      return {};
     }
 
-    return Handler->second(Leaf);
+    if (!Entry->NumLeafs) {
+      return Entry->Results[0];
+    }
+
+    if (Leaf < Entry->NumLeafs) {
+      return Entry->Results[Leaf];
+    }
+
+    // Leafs past the precomputed range still need to be generated
+    return (this->*Entry->Handler)(Leaf);
+  }
+
+  /**
+   * @brief Does the result of this function depend on the leaf passed in ECX
+   */
+  bool DoesFunctionDependOnLeaf(uint32_t Function) {
+    auto Entry = GetFunctionEntry(Function);
+    return Entry && Entry->Handler && Entry->NumLeafs;
   }
+
+  /**
+   * @brief Scale from the host cycle counter to the guest TSC
+   *
+   * GuestTSC = HostCounter * Integer + umulh(HostCounter, Fraction)
+   * Identity when the guest runs at the host counter frequency.
+   */
+  struct TSCScale {
+    uint64_t Integer{1};
+    uint64_t Fraction{};
+
+    bool IsIdentity() const { return Integer == 1 && Fraction == 0; }
+  };
+
+  uint64_t GetTSCFrequency() const { return TSCFrequency; }
+  // Hash of every precomputed result, changes whenever a folded CPUID could
+  uint64_t GetResultsHash() const;
+  TSCScale const &GetTSCScale() const { return Scale; }
+
 private:
   FEXCore::Context::Context *CTX;
   FEX_CONFIG_OPT(Cores, THREADS);
+  FEX_CONFIG_OPT(TSCFrequencyMHz, TSCFREQUENCY);
 
-  using FunctionHandler = std::function<FEXCore::CPUID::FunctionResults(uint32_t Leaf)>;
-  void RegisterFunction(uint32_t Function, FunctionHandler Handler) {
-    FunctionHandlers[Function] = Handler;
+  uint64_t TSCFrequency{};
+  TSCScale Scale{};
+
+  using FunctionHandler = FEXCore::CPUID::FunctionResults (CPUIDEmu::*)(uint32_t Leaf);
+
+  // Results are precomputed at init since none of them change over the lifetime of the context
+  constexpr static uint32_t MAX_PRECOMPUTED_LEAFS = 4;
+  struct FunctionEntry {
+    FunctionHandler Handler;
+    // Zero if the function ignores the leaf
+    uint32_t NumLeafs;
+    std::array<FEXCore::CPUID::FunctionResults, MAX_PRECOMPUTED_LEAFS> Results;
+  };
+
+  constexpr static uint32_t STANDARD_FUNCTION_BASE = 0;
+  constexpr static uint32_t EXTENDED_FUNCTION_BASE = 0x8000'0000;
+  constexpr static uint32_t NUM_STANDARD_FUNCTIONS = 0x20;
+  constexpr static uint32_t NUM_EXTENDED_FUNCTIONS = 0x20;
+
+  std::array<FunctionEntry, NUM_STANDARD_FUNCTIONS> StandardFunctions{};
+  std::array<FunctionEntry, NUM_EXTENDED_FUNCTIONS> ExtendedFunctions{};
+
+  FunctionEntry *GetFunctionEntry(uint32_t Function) {
+    if ((Function - STANDARD_FUNCTION_BASE) < NUM_STANDARD_FUNCTIONS) {
+      return &StandardFunctions[Function - STANDARD_FUNCTION_BASE];
+    }
+    if ((Function - EXTENDED_FUNCTION_BASE) < NUM_EXTENDED_FUNCTIONS) {
+      return &ExtendedFunctions[Function - EXTENDED_FUNCTION_BASE];
+    }
+    return nullptr;
   }
 
-  std::unordered_map<uint32_t, FunctionHandler> FunctionHandlers;
+  void RegisterFunction(uint32_t Function, FunctionHandler Handler, uint32_t NumLeafs = 0) {
+    FunctionEntry *Entry = GetFunctionEntry(Function);
+    LOGMAN_THROW_A_FMT(Entry != nullptr, "CPUID function 0x{:x} out of range", Function);
+    LOGMAN_THROW_A_FMT(NumLeafs <= MAX_PRECOMPUTED_LEAFS, "Too many leafs for CPUID function 0x{:x}", Function);
+
+    Entry->Handler = Handler;
+    Entry->NumLeafs = NumLeafs;
+    for (uint32_t Leaf = 0; Leaf < std::max(NumLeafs, 1U); ++Leaf) {
+      Entry->Results[Leaf] = (this->*Handler)(Leaf);
+    }
+  }
 
   // Functions
   FEXCore::CPUID::FunctionResults Function_0h(uint32_t Leaf);
@@ -53,6 +127,7 @@ private:
   FEXCore::CPUID::FunctionResults Function_07h(uint32_t Leaf);
   FEXCore::CPUID::FunctionResults Function_0Dh(uint32_t Leaf);
   FEXCore::CPUID::FunctionResults Function_15h(uint32_t Leaf);
+  FEXCore::CPUID::FunctionResults Function_16h(uint32_t Leaf);
   FEXCore::CPUID::FunctionResults Function_8000_0000h(uint32_t Leaf);
   FEXCore::CPUID::FunctionResults Function_8000_0001h(uint32_t Leaf);
   FEXCore::CPUID::FunctionResults Function_8000_0002h(uint32_t Leaf);
@@ -29,10 +29,12 @@ $end_info$
 #include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/Telemetry.h>
 
 #include "Interface/HLE/Thunks/Thunks.h"
 #include "FEXCore/Utils/Allocator.h"
 
+#include <fmt/format.h>
 #include <xxhash.h>
 #include <fstream>
 #include <unistd.h>
@@ -161,9 +163,9 @@ namespace FEXCore::Context {
   }
 
   Context::Context() {
-#ifdef BLOCKSTATS
-    BlockData = std::make_unique<FEXCore::BlockSamplingData>();
-#endif
+    if (Config.BlockStats() != "no") {
+      BlockData = std::make_unique<FEXCore::BlockSamplingData>(this, Config.BlockStats());
+    }
     if (Config.GdbServer) {
       StartGdbServer();
     }
@@ -190,6 +192,11 @@ namespace FEXCore::Context {
       Threads.clear();
     }
 
+    // Every thread is gone so the counters are final
+    if (BlockData) {
+      BlockData->DumpBlockData();
+    }
+
     for (auto &Mod: AOTIRCache) {
       FEXCore::Allocator::munmap(Mod.second.mapping, Mod.second.size);
     }
@@ -229,6 +236,15 @@ namespace FEXCore::Context {
 
     InitializeThreadData(Thread);
 
+    // Record which correctness relaxations were active so that any bug reports can be correlated with them
+    FEXCORE_TELEMETRY_INIT(Relaxations, TYPE_PERF_RELAXATIONS);
+    FEXCORE_TELEMETRY_SET(Relaxations,
+      (Config.TSOEnabled ? 0 : (1U << 0)) |
+      (Config.ABILocalFlags ? (1U << 1) : 0) |
+      (Config.ABINoPF ? (1U << 2) : 0) |
+      (Config.Multiblock ? (1U << 3) : 0) |
+      (Config.SMCChecks == FEXCore::Config::CONFIG_SMC_NONE ? (1U << 4) : 0));
+
     return true;
   }
 
@@ -283,13 +299,17 @@ namespace FEXCore::Context {
     WaitForIdle();
   }
 
-  void Context::NotifyPause() {
+  void Context::NotifyPause(FEXCore::Core::InternalThreadState *IgnoreThread) {
 
     // Tell all the threads that they should pause
     std::lock_guard<std::mutex> lk(ThreadCreationMutex);
     for (auto &Thread : Threads) {
+      if (Thread == IgnoreThread) {
+        continue;
+      }
+
       Thread->SignalReason.store(FEXCore::Core::SignalEvent::Pause);
-      if (Thread->RunningEvents.Running.load()) {
+      if (Thread->RunningEvents.Running.load() && !Thread->RunningEvents.Sleeping.load()) {
         // Only attempt to stop this thread if it is running
         tgkill(Thread->ThreadManager.PID, Thread->ThreadManager.TID, SignalDelegator::SIGNAL_FOR_PAUSE);
       }
@@ -306,6 +326,8 @@ namespace FEXCore::Context {
   }
 
   void Context::Run() {
+    DebugStopReported = false;
+
     // Spin up all the threads
     std::lock_guard<std::mutex> lk(ThreadCreationMutex);
     for (auto &Thread : Threads) {
@@ -385,6 +407,45 @@ namespace FEXCore::Context {
     }
   }
 
+  void Context::NotifyDebugStop(FEXCore::Core::InternalThreadState *Thread, bool WatchpointStop) {
+    if (DebugStopReported.exchange(true)) {
+      // Another thread already stopped the world
+      return;
+    }
+
+    // The debugger expects every thread to be stopped when it gets the stop reply
+    NotifyPause(Thread);
+    WaitForIdle();
+
+    if (DebugServer && !DebugServer->ShouldReportDebugStop(WatchpointStop)) {
+      Run();
+      return;
+    }
+
+    if (CustomExitHandler) {
+      CustomExitHandler(Thread->ThreadManager.TID, FEXCore::Context::ExitReason::EXIT_DEBUG);
+    }
+  }
+
+  void Context::HandleDebugBreakpoint(FEXCore::Core::CpuStateFrame *Frame) {
+    auto Thread = Frame->Thread;
+    auto CTX = Thread->CTX;
+
+    Thread->RunningEvents.Sleeping = true;
+    --CTX->IdleWaitRefCount;
+    CTX->IdleWaitCV.notify_all();
+
+    CTX->NotifyDebugStop(Thread);
+
+    // Sleep until the debugger resumes us
+    Thread->StartRunning.Wait();
+
+    Thread->RunningEvents.Sleeping = false;
+    Thread->RunningEvents.Running = true;
+    ++CTX->IdleWaitRefCount;
+    CTX->IdleWaitCV.notify_all();
+  }
+
   void Context::StopThread(FEXCore::Core::InternalThreadState *Thread) {
     if (Thread->RunningEvents.Running.exchange(false)) {
       Thread->SignalReason.store(FEXCore::Core::SignalEvent::Stop);
@@ -479,10 +540,11 @@ namespace FEXCore::Context {
     bool DoSRA = false;
     #endif
 
-    State->PassManager->AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT, DoSRA);
+    State->PassManager->AddDefaultPasses(Config.Core == FEXCore::Config::CONFIG_IRJIT, DoSRA, HostFeatures.SupportsTSOImm9);
     State->PassManager->AddDefaultValidationPasses();
 
     State->PassManager->RegisterSyscallHandler(SyscallHandler);
+    State->PassManager->RegisterCPUIDHandler(&CPUID);
 
     // Create CPU backend
     switch (Config.Core) {
@@ -630,6 +692,10 @@ namespace FEXCore::Context {
 
     const uint8_t GPRSize = GetGPRSize();
 
+    // Held for the whole function so the breakpoints can't change under us
+    std::shared_lock BreakpointLK(BreakpointLock);
+    const bool CheckBreakpoints = !Breakpoints.empty();
+
     for (size_t j = 0; j < CodeBlocks->size(); ++j) {
       FEXCore::Frontend::Decoder::DecodedBlocks const &Block = CodeBlocks->at(j);
       // Set the block entry point
@@ -648,6 +714,39 @@ namespace FEXCore::Context {
         break;
       }
 
+      if (Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) {
+        // Check the whole block against a hash of the code it was decoded from, once on entry
+        uint64_t BlockLength{};
+        for (size_t i = 0; i < InstsInBlock; ++i) {
+          BlockLength += Block.DecodedInstructions[i].InstSize;
+        }
+
+        auto CodeHash = XXH3_64bits(reinterpret_cast<void const*>(Block.Entry), BlockLength);
+        auto CodeChanged = Thread->OpDispatcher->_ValidateCode(CodeHash, Block.Entry - GuestRIP, BlockLength);
+
+        auto InvalidateCodeCond = Thread->OpDispatcher->_CondJump(CodeChanged);
+
+        auto CurrentBlock = Thread->OpDispatcher->GetCurrentBlock();
+        auto CodeWasChangedBlock = Thread->OpDispatcher->CreateNewCodeBlockAtEnd();
+        Thread->OpDispatcher->SetTrueJumpTarget(InvalidateCodeCond, CodeWasChangedBlock);
+
+        Thread->OpDispatcher->SetCurrentCodeBlock(CodeWasChangedBlock);
+        Thread->OpDispatcher->_RemoveCodeEntry();
+        Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_EntrypointOffset(Block.Entry - GuestRIP, GPRSize));
+
+        auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlockAfter(CurrentBlock);
+
+        Thread->OpDispatcher->SetFalseJumpTarget(InvalidateCodeCond, NextOpBlock);
+        Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
+      }
+
+      if (Config.Deterministic) {
+        // Retire the whole block on entry, a RDTSC partway through sees the same count on every run
+        auto TSC = Thread->OpDispatcher->_LoadContext(8, offsetof(FEXCore::Core::CPUState, VirtualTSC), FEXCore::IR::GPRClass);
+        auto NewTSC = Thread->OpDispatcher->_Add(TSC, Thread->OpDispatcher->_Constant(InstsInBlock));
+        Thread->OpDispatcher->_StoreContext(FEXCore::IR::GPRClass, 8, offsetof(FEXCore::Core::CPUState, VirtualTSC), NewTSC);
+      }
+
       for (size_t i = 0; i < InstsInBlock; ++i) {
         FEXCore::X86Tables::X86InstInfo const* TableInfo {nullptr};
         FEXCore::X86Tables::DecodedInst const* DecodedInfo {nullptr};
@@ -655,26 +754,18 @@ namespace FEXCore::Context {
         TableInfo = Block.DecodedInstructions[i].TableInfo;
         DecodedInfo = &Block.DecodedInstructions[i];
         bool IsLocked = DecodedInfo->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_LOCK;
+        bool IsBreakpoint = CheckBreakpoints && Breakpoints.contains(DecodedInfo->PC);
 
-        if (Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) {
-          auto ExistingCodePtr = reinterpret_cast<uint64_t*>(Block.Entry + BlockInstructionsLength);
-
-          auto CodeChanged = Thread->OpDispatcher->_ValidateCode(ExistingCodePtr[0], ExistingCodePtr[1], (uintptr_t)ExistingCodePtr - GuestRIP, DecodedInfo->InstSize);
-
-          auto InvalidateCodeCond = Thread->OpDispatcher->_CondJump(CodeChanged);
-
-          auto CurrentBlock = Thread->OpDispatcher->GetCurrentBlock();
-          auto CodeWasChangedBlock = Thread->OpDispatcher->CreateNewCodeBlockAtEnd();
-          Thread->OpDispatcher->SetTrueJumpTarget(InvalidateCodeCond, CodeWasChangedBlock);
-
-          Thread->OpDispatcher->SetCurrentCodeBlock(CodeWasChangedBlock);
-          Thread->OpDispatcher->_RemoveCodeEntry();
-          Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_EntrypointOffset(Block.Entry + BlockInstructionsLength - GuestRIP, GPRSize));
-
-          auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlockAfter(CurrentBlock);
+        if (IsBreakpoint) {
+          if (DecodedInfo->PC != GuestRIP) {
+            // Breakpoints are only ever checked at the entry of a function
+            // Leave so the dispatcher comes back in with a new function starting at the breakpoint
+            Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_EntrypointOffset(DecodedInfo->PC - GuestRIP, GPRSize));
+            break;
+          }
 
-          Thread->OpDispatcher->SetFalseJumpTarget(InvalidateCodeCond, NextOpBlock);
-          Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
+          Thread->OpDispatcher->_StoreContext(FEXCore::IR::GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, rip), Thread->OpDispatcher->_EntrypointOffset(0, GPRSize));
+          Thread->OpDispatcher->_DebugBreakpoint();
         }
 
         if (TableInfo->OpcodeDispatcher) {
@@ -716,6 +807,12 @@ namespace FEXCore::Context {
           }
         }
 
+        if (IsBreakpoint) {
+          // Only run the breakpointed instruction, so stepping from the breakpoint stops on the next instruction
+          Thread->OpDispatcher->ExitFunctionAfterOp(DecodedInfo->PC + DecodedInfo->InstSize);
+          break;
+        }
+
         if (Thread->OpDispatcher->FinishOp(DecodedInfo->PC + DecodedInfo->InstSize, i + 1 == InstsInBlock)) {
           break;
         }
@@ -901,7 +998,8 @@ namespace FEXCore::Context {
       }
     }
 
-    if (IRList == nullptr && Config.AOTIRLoad) {
+    // Cached IR doesn't have any breakpoints in it
+    if (IRList == nullptr && Config.AOTIRLoad && !HasBreakpoints()) {
       std::shared_lock lk(AOTIRCacheLock);
       auto file = AddrToFile.lower_bound(GuestRIP);
       if (file != AddrToFile.begin()) {
@@ -990,7 +1088,7 @@ namespace FEXCore::Context {
   bool Context::LoadAOTIRCache(int streamfd) {
     uint64_t tag;
 
-    if (!readAll(streamfd, (char*)&tag, sizeof(tag)) || tag != 0xDEADBEEFC0D30004)
+    if (!readAll(streamfd, (char*)&tag, sizeof(tag)) || tag != 0xDEADBEEFC0D30005)
       return false;
 
     std::string Module;
@@ -1115,6 +1213,13 @@ namespace FEXCore::Context {
     bool GeneratedIR {};
     uint64_t StartAddr {}, Length {};
 
+    // Only one thread compiles at a time so the compile sequence doesn't depend on how the threads race.
+    // Recursive since a signal can land in the middle of a compile and need to compile its handler.
+    std::unique_lock<std::recursive_mutex> DeterministicLK;
+    if (Config.Deterministic) {
+      DeterministicLK = std::unique_lock{DeterministicCompileMutex};
+    }
+
     if (Thread->CompileBlockReentrantRefCount != 0) {
       if (!Thread->CompileService) {
         Thread->CompileService = std::make_shared<FEXCore::CompileService>(this, Thread);
@@ -1188,7 +1293,7 @@ namespace FEXCore::Context {
 
               if (!AotFile->Stream) {
                 AotFile->Stream = AOTIRWriter(fileid);
-                uint64_t tag = 0xDEADBEEFC0D30004;
+                uint64_t tag = 0xDEADBEEFC0D30005;
                 AotFile->Stream->write((char*)&tag, sizeof(tag));
               }
               AotFile->AppendAOTIRCaptureCache(LocalRIP, LocalStartAddr, Length, hash, IRList, RAData);
@@ -1275,17 +1380,21 @@ namespace FEXCore::Context {
     }
   }
 
+  static void RemoveCodeEntriesInRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length) {
+    auto lower = Thread->LookupCache->CodePages.lower_bound(Start >> 12);
+    auto upper = Thread->LookupCache->CodePages.upper_bound((Start + Length) >> 12);
+
+    for (auto it = lower; it != upper; it++) {
+      for (auto Address: it->second)
+        Context::RemoveCodeEntry(Thread, Address);
+      it->second.clear();
+    }
+  }
+
   void FlushCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length) {
 
     if (Thread->CTX->Config.SMCChecks == FEXCore::Config::CONFIG_SMC_MMAN) {
-      auto lower = Thread->LookupCache->CodePages.lower_bound(Start >> 12);
-      auto upper = Thread->LookupCache->CodePages.upper_bound((Start + Length) >> 12);
-
-      for (auto it = lower; it != upper; it++) {
-        for (auto Address: it->second)
-          Context::RemoveCodeEntry(Thread, Address);
-        it->second.clear();
-      }
+      RemoveCodeEntriesInRange(Thread, Start, Length);
     }
   }
 
@@ -1294,6 +1403,59 @@ namespace FEXCore::Context {
     Thread->LookupCache->Erase(GuestRIP);
   }
 
+  void Context::InvalidateCodeForBreakpoint(uint64_t RIP) {
+    // Any block that covers the breakpoint needs to be regenerated, not just one starting at it
+    std::lock_guard<std::mutex> lk(ThreadCreationMutex);
+    for (auto &Thread : Threads) {
+      RemoveCodeEntriesInRange(Thread, RIP, 1);
+    }
+  }
+
+  void Context::AddBreakpoint(uint64_t RIP) {
+    {
+      std::unique_lock lk(BreakpointLock);
+      if (!Breakpoints.insert(RIP).second) {
+        return;
+      }
+    }
+
+    InvalidateCodeForBreakpoint(RIP);
+  }
+
+  void Context::RemoveBreakpoint(uint64_t RIP) {
+    {
+      std::unique_lock lk(BreakpointLock);
+      if (!Breakpoints.erase(RIP)) {
+        return;
+      }
+    }
+
+    InvalidateCodeForBreakpoint(RIP);
+  }
+
+  bool Context::HasBreakpoints() {
+    std::shared_lock lk(BreakpointLock);
+    return !Breakpoints.empty();
+  }
+
+  void Context::SuspendWatchpoints() {
+    if (DebugServer) {
+      DebugServer->SuspendWatchpoints();
+    }
+  }
+
+  void Context::ResumeWatchpoints() {
+    if (DebugServer) {
+      DebugServer->ResumeWatchpoints();
+    }
+  }
+
+  void Context::NotifyGuestMappingChanged(uint64_t Start, uint64_t Length) {
+    if (DebugServer) {
+      DebugServer->GuestMappingChanged(Start, Length);
+    }
+  }
+
   // Debug interface
   void Context::CompileRIP(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP) {
     uint64_t RIPBackup = Thread->CurrentFrame->State.rip;
@@ -1338,7 +1500,10 @@ namespace FEXCore::Context {
 
   uint64_t HandleSyscall(FEXCore::HLE::SyscallHandler *Handler, FEXCore::Core::CpuStateFrame *Frame, FEXCore::HLE::SyscallArguments *Args) {
     uint64_t Result{};
+    auto CTX = Frame->Thread->CTX;
+    CTX->SuspendWatchpoints();
     Result = Handler->HandleSyscall(Frame, Args);
+    CTX->ResumeWatchpoints();
     return Result;
   }
 
@@ -1356,6 +1521,14 @@ namespace FEXCore::Context {
       fileid += Config.TSOEnabled ? "T" : "t";
       fileid += Config.ABILocalFlags ? "L" : "l";
       fileid += Config.ABINoPF ? "p" : "P";
+      fileid += Config.Multiblock ? "M" : "m";
+      fileid += Config.Deterministic ? "D" : "d";
+      // RDTSC rescaling is baked in to the IR
+      if (!CPUID.GetTSCScale().IsIdentity()) {
+        fileid += "-tsc" + std::to_string(CPUID.GetTSCFrequency());
+      }
+      // Folded CPUID results and host feature checks in the frontend are baked in as well
+      fileid += fmt::format("-hf{:x}-cpuid{:x}", HostFeatures.GetFeatureBits(), CPUID.GetResultsHash());
 
       std::unique_lock lk(AOTIRCacheLock);
 
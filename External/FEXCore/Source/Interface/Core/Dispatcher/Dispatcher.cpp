@@ -9,12 +9,21 @@ namespace FEXCore::CPU {
 void Dispatcher::SleepThread(FEXCore::Context::Context *ctx, FEXCore::Core::CpuStateFrame *Frame) {
   auto Thread = Frame->Thread;
 
+  // Already paused, don't let another pause request signal us
+  Thread->RunningEvents.Sleeping = true;
   --ctx->IdleWaitRefCount;
   ctx->IdleWaitCV.notify_all();
 
+  if (Thread->ExitReason == FEXCore::Context::ExitReason::EXIT_DEBUG) {
+    // Stopped for the debugger, eg. a watchpoint was hit
+    Thread->ExitReason = FEXCore::Context::ExitReason::EXIT_NONE;
+    ctx->NotifyDebugStop(Thread, true);
+  }
+
   // Go to sleep
   Thread->StartRunning.Wait();
 
+  Thread->RunningEvents.Sleeping = false;
   Thread->RunningEvents.Running = true;
   ++ctx->IdleWaitRefCount;
   ctx->IdleWaitCV.notify_all();
@@ -72,6 +81,9 @@ void Dispatcher::RestoreThreadState(void *ucontext) {
 }
 
 bool Dispatcher::HandleGuestSignal(int Signal, void *info, void *ucontext, GuestSigAction *GuestAction, stack_t *GuestStack) {
+  // The frame goes on the guest stack, which may be watched
+  CTX->SuspendWatchpoints();
+
   StoreThreadState(Signal, ucontext);
   auto Frame = ThreadState->CurrentFrame;
 
@@ -320,6 +332,7 @@ bool Dispatcher::HandleGuestSignal(int Signal, void *info, void *ucontext, Guest
     Frame->State.gregs[X86State::REG_RSP] = NewGuestSP;
   }
 
+  CTX->ResumeWatchpoints();
   return true;
 }
 
@@ -335,6 +348,17 @@ bool Dispatcher::HandleSIGILL(int Signal, void *info, void *ucontext) {
   }
 
   if (ArchHelpers::Context::GetPc(ucontext) == PauseReturnInstruction) {
+    if (PendingSignalPauses == 0) {
+      // The JIT jumped to the pause handler itself, when single stepping or from a debug stop
+      // RIP is already in the context and there is no host state to restore, so restart the dispatcher
+      auto Frame = ThreadState->CurrentFrame;
+      ArchHelpers::Context::SetSp(ucontext, Frame->ReturningStackLocation);
+      ArchHelpers::Context::SetPc(ucontext, AbsoluteLoopTopAddressFillSRA);
+      ArchHelpers::Context::SetState(ucontext, reinterpret_cast<uint64_t>(Frame));
+      return true;
+    }
+
+    --PendingSignalPauses;
     RestoreThreadState(ucontext);
 
     // Ref count our faults
@@ -353,6 +377,7 @@ bool Dispatcher::HandleSignalPause(int Signal, void *info, void *ucontext) {
   if (SignalReason == FEXCore::Core::SignalEvent::Pause) {
     // Store our thread state so we can come back to this
     StoreThreadState(Signal, ucontext);
+    ++PendingSignalPauses;
 
     if (SRAEnabled && IsAddressInJITCode(ArchHelpers::Context::GetPc(ucontext), false)) {
       // We are in jit, SRA must be spilled
@@ -39,6 +39,8 @@ public:
   /**  @} */
 
   uint32_t SignalHandlerRefCounter{};
+  // Pauses that came from a signal and have host state to restore on resume
+  uint32_t PendingSignalPauses{};
 
   uint64_t Start{};
   uint64_t End{};
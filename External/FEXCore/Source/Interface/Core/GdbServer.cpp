@@ -5,6 +5,7 @@ desc: Provides a gdb interface to the guest state
 $end_info$
 */
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstdio>
 #include <iomanip>
@@ -24,6 +25,7 @@ $end_info$
 #include <fmt/format.h>
 #include <fstream>
 #include <netdb.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -46,16 +48,67 @@ void GdbServer::Break(int signal) {
     SendPacket(*CommsStream, str);
 }
 
+void GdbServer::ReportDebugStop() {
+    Watchpoint Hit;
+    uint64_t HitAddr;
+    {
+      ScopedProtectLock lk(this);
+      Hit = WatchpointHit;
+      HitAddr = WatchpointHitAddr;
+    }
+
+    if (Hit.Type != 0) {
+      const char *Kind = Hit.Type == 2 ? "watch" :
+                         Hit.Type == 3 ? "rwatch" : "awatch";
+
+      std::lock_guard lk(sendMutex);
+      if (CommsStream) {
+        SendPacket(*CommsStream, fmt::format("T05{}:{:x};thread:{:02x};", Kind, HitAddr, getpid()));
+      }
+    }
+    else {
+      Break(SIGTRAP);
+    }
+}
+
+bool GdbServer::ShouldReportDebugStop(bool WatchpointStop) {
+    ScopedProtectLock lk(this);
+    if (!WatchpointStop || WatchpointHit.Type != 0) {
+      return true;
+    }
+
+    // Only an unwatched address on a watched page was touched, the debugger doesn't need to know
+    CTX->Config.RunningMode = ModeBeforeFault;
+    WatchpointsNeedRearm = false;
+    ProtectWatchedPages(true);
+    return false;
+}
+
+void GdbServer::PrepareResume() {
+    // A watchpoint stop leaves the guest stopping at every block
+    CTX->Config.RunningMode = FEXCore::Context::CoreRunningMode::MODE_RUN;
+
+    ScopedProtectLock lk(this);
+    WatchpointHit = {};
+    WatchpointsNeedRearm = false;
+    ProtectWatchedPages(true);
+}
+
 GdbServer::GdbServer(FEXCore::Context::Context *ctx) : CTX(ctx) {
     Context::SetExitHandler(ctx, [this](uint64_t ThreadId, FEXCore::Context::ExitReason ExitReason) {
         if (ExitReason == FEXCore::Context::ExitReason::EXIT_DEBUG) {
-            this->Break(SIGTRAP);
+            this->ReportDebugStop();
         }
     });
 
     // This is a total hack as there is currently no way to resume once hitting a segfault
     // But it's semi-useful for debugging.
     ctx->SignalDelegation->RegisterHostSignalHandler(SIGSEGV, [this] (FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) {
+        auto FaultAddr = reinterpret_cast<uint64_t>(reinterpret_cast<siginfo_t*>(info)->si_addr);
+        if (this->HandleWatchpointFault(Thread, FaultAddr)) {
+          return true;
+        }
+
         this->Break(SIGSEGV);
 
         this->CTX->Config.RunningMode = FEXCore::Context::CoreRunningMode::MODE_SINGLESTEP;
@@ -771,10 +824,12 @@ GdbServer::HandledPacketType GdbServer::handleV(const std::string& packet) {
 
         switch (action) {
         case 'c': {
+            PrepareResume();
             CTX->Run();
             return {"", HandledPacketType::TYPE_ONLYACK};
           }
         case 's': {
+            PrepareResume();
             CTX->Step();
             SendPacketPair({"OK", HandledPacketType::TYPE_ACK});
             auto str = fmt::format("T05thread:{:02x};core:2c;", getpid());
@@ -821,20 +876,339 @@ GdbServer::HandledPacketType GdbServer::handleThreadOp(const std::string &packet
   return {"", HandledPacketType::TYPE_UNKNOWN};
 }
 
+static int GetPageProtection(uint64_t Page) {
+  std::ifstream Maps("/proc/self/maps");
+  std::string Line;
+
+  while (std::getline(Maps, Line)) {
+    uint64_t Begin, End;
+    char Perms[5]{};
+    if (sscanf(Line.c_str(), "%lx-%lx %4s", &Begin, &End, Perms) != 3) {
+      continue;
+    }
+
+    if (Page >= Begin && Page < End) {
+      return (Perms[0] == 'r' ? PROT_READ : 0) |
+             (Perms[1] == 'w' ? PROT_WRITE : 0) |
+             (Perms[2] == 'x' ? PROT_EXEC : 0);
+    }
+  }
+
+  return -1;
+}
+
+GdbServer::ScopedProtectLock::ScopedProtectLock(GdbServer *Server)
+  : Server {Server} {
+  sigset_t Full;
+  sigfillset(&Full);
+  pthread_sigmask(SIG_SETMASK, &Full, &OldMask);
+
+  while (Server->ProtectLock.test_and_set(std::memory_order_acquire)) {
+    // Only ever held for a few mprotects
+  }
+}
+
+GdbServer::ScopedProtectLock::~ScopedProtectLock() {
+  Server->ProtectLock.clear(std::memory_order_release);
+  pthread_sigmask(SIG_SETMASK, &OldMask, nullptr);
+}
+
+void GdbServer::ProtectWatchedPage(WatchedPage &Page, bool Arm) {
+  if (Page.Protection < 0) {
+    // Nothing to protect, the fault is the guest's own
+    Page.Armed = false;
+    return;
+  }
+
+  if (!Arm) {
+    if (Page.Armed) {
+      mprotect(reinterpret_cast<void*>(Page.Page), FEXCore::Core::PAGE_SIZE, Page.Protection);
+      Page.Armed = false;
+    }
+    return;
+  }
+
+  // Write watchpoints can leave the page readable
+  bool WriteOnly = true;
+  for (size_t i = 0; i < NumWatchpoints; ++i) {
+    auto &Watch = Watchpoints[i];
+    if (Watch.Type != 2 &&
+        Watch.Addr < (Page.Page + FEXCore::Core::PAGE_SIZE) &&
+        (Watch.Addr + Watch.Length) > Page.Page) {
+      WriteOnly = false;
+      break;
+    }
+  }
+
+  mprotect(reinterpret_cast<void*>(Page.Page), FEXCore::Core::PAGE_SIZE, WriteOnly ? (Page.Protection & ~PROT_WRITE) : PROT_NONE);
+  Page.Armed = true;
+}
+
+void GdbServer::ProtectWatchedPages(bool Arm) {
+  // Pages stay open while the host accesses guest memory, the last resume protects them again
+  if (Arm && SuspendCount != 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < NumWatchedPages; ++i) {
+    ProtectWatchedPage(WatchedPages[i], Arm);
+  }
+}
+
+void GdbServer::SuspendWatchpoints() {
+  if (NumWatchedPages.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+
+  ScopedProtectLock lk(this);
+  if (SuspendCount++ == 0) {
+    ProtectWatchedPages(false);
+  }
+}
+
+void GdbServer::ResumeWatchpoints() {
+  if (NumWatchedPages.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+
+  ScopedProtectLock lk(this);
+  if (SuspendCount == 0) {
+    // Watchpoints were inserted while this access was in flight
+    return;
+  }
+
+  if (--SuspendCount == 0) {
+    ProtectWatchedPages(true);
+  }
+}
+
+void GdbServer::GuestMappingChanged(uint64_t Start, uint64_t Length) {
+  if (NumWatchedPages.load(std::memory_order_relaxed) == 0 || Length == 0) {
+    return;
+  }
+
+  // Read the new protections before taking the lock, parsing maps isn't something to do with signals blocked
+  std::array<int, MaxWatchedPages> Protections;
+  std::array<uint64_t, MaxWatchedPages> Pages;
+  size_t NumPages{};
+  {
+    ScopedProtectLock lk(this);
+    for (size_t i = 0; i < NumWatchedPages; ++i) {
+      Pages[i] = WatchedPages[i].Page;
+    }
+    NumPages = NumWatchedPages;
+  }
+
+  for (size_t i = 0; i < NumPages; ++i) {
+    if (Pages[i] < (Start + Length) && (Pages[i] + FEXCore::Core::PAGE_SIZE) > Start) {
+      Protections[i] = GetPageProtection(Pages[i]);
+    }
+  }
+
+  ScopedProtectLock lk(this);
+  for (size_t i = 0; i < NumPages && i < NumWatchedPages; ++i) {
+    auto &Page = WatchedPages[i];
+    if (Page.Page != Pages[i] ||
+        Page.Page >= (Start + Length) || (Page.Page + FEXCore::Core::PAGE_SIZE) <= Start) {
+      continue;
+    }
+
+    // Whatever the guest asked for replaced our protection
+    Page.Protection = Protections[i];
+    Page.Armed = false;
+    if (SuspendCount == 0) {
+      ProtectWatchedPage(Page, true);
+    }
+  }
+}
+
+bool GdbServer::HandleWatchpointFault(FEXCore::Core::InternalThreadState *Thread, uint64_t FaultAddr) {
+  if (NumWatchedPages.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  const uint64_t PageAddr = FaultAddr & ~(FEXCore::Core::PAGE_SIZE - 1);
+
+  ScopedProtectLock lk(this);
+  WatchedPage *Page{};
+  for (size_t i = 0; i < NumWatchedPages; ++i) {
+    if (WatchedPages[i].Page == PageAddr) {
+      Page = &WatchedPages[i];
+      break;
+    }
+  }
+
+  // Faults on the watched page this thread retried last
+  static thread_local uint64_t RetriedFault{};
+
+  if (!Page || !Page->Armed) {
+    // The page could have been opened between the fault and taking the lock, so try the access once more.
+    // Faulting again with the guest's protection in place is a real fault.
+    if (Page && RetriedFault != FaultAddr) {
+      RetriedFault = FaultAddr;
+      return true;
+    }
+
+    RetriedFault = 0;
+    return false;
+  }
+  RetriedFault = 0;
+
+  // Let the access through, the page gets protected again when the guest continues
+  ProtectWatchedPage(*Page, false);
+
+  if (WatchpointHit.Type == 0) {
+    for (size_t i = 0; i < NumWatchpoints; ++i) {
+      auto &Watch = Watchpoints[i];
+      if (FaultAddr >= Watch.Addr && FaultAddr < (Watch.Addr + Watch.Length)) {
+        WatchpointHit = Watch;
+        WatchpointHitAddr = FaultAddr;
+        break;
+      }
+    }
+  }
+
+  // Stop everything once the current block is done so the access has completed when the debugger looks.
+  // Even if no watchpoint matched, the page needs to be protected again.
+  if (!WatchpointsNeedRearm) {
+    ModeBeforeFault = CTX->Config.RunningMode;
+    WatchpointsNeedRearm = true;
+  }
+  Thread->ExitReason = FEXCore::Context::ExitReason::EXIT_DEBUG;
+  CTX->Config.RunningMode = FEXCore::Context::CoreRunningMode::MODE_SINGLESTEP;
+  return true;
+}
+
+GdbServer::HandledPacketType GdbServer::handleWatchpoint(bool Set, uint64_t Type, uint64_t Addr, uint64_t Length) {
+  if (Length == 0 || (Addr + Length) < Addr) {
+    return {"E01", HandledPacketType::TYPE_ACK};
+  }
+
+  const uint64_t FirstPage = Addr & ~(FEXCore::Core::PAGE_SIZE - 1);
+  const uint64_t LastPage = (Addr + Length - 1) & ~(FEXCore::Core::PAGE_SIZE - 1);
+
+  auto IsWatched = [this](uint64_t Page) {
+    for (size_t i = 0; i < NumWatchedPages; ++i) {
+      if (WatchedPages[i].Page == Page) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  if (Set) {
+    // Everything is checked before anything changes, so a failure doesn't leave half a watchpoint behind
+    std::array<WatchedPage, MaxWatchedPages> NewPages;
+    size_t NumNewPages{};
+    for (uint64_t Page = FirstPage; Page <= LastPage; Page += FEXCore::Core::PAGE_SIZE) {
+      if (IsWatched(Page)) {
+        continue;
+      }
+
+      if ((NumWatchedPages + NumNewPages) == MaxWatchedPages) {
+        return {"E01", HandledPacketType::TYPE_ACK};
+      }
+
+      int Protection = GetPageProtection(Page);
+      if (Protection < 0) {
+        return {"E01", HandledPacketType::TYPE_ACK};
+      }
+      NewPages[NumNewPages++] = {Page, Protection, false};
+    }
+
+    if (NumWatchpoints == MaxWatchpoints) {
+      return {"E01", HandledPacketType::TYPE_ACK};
+    }
+
+    ScopedProtectLock lk(this);
+    Watchpoints[NumWatchpoints++] = {Addr, Length, Type};
+    for (size_t i = 0; i < NumNewPages; ++i) {
+      WatchedPages[NumWatchedPages] = NewPages[i];
+      NumWatchedPages.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Also picks up the watch type change of pages that were already watched
+    ProtectWatchedPages(true);
+  }
+  else {
+    ScopedProtectLock lk(this);
+    for (size_t i = 0; i < NumWatchpoints; ++i) {
+      auto &Watch = Watchpoints[i];
+      if (Watch.Addr == Addr && Watch.Length == Length && Watch.Type == Type) {
+        Watchpoints[i] = Watchpoints[--NumWatchpoints];
+        break;
+      }
+    }
+
+    // Give back the original protection to pages that no longer have a watchpoint
+    for (size_t i = 0; i < NumWatchedPages;) {
+      auto &Page = WatchedPages[i];
+      bool Used = false;
+      for (size_t j = 0; j < NumWatchpoints; ++j) {
+        auto &Watch = Watchpoints[j];
+        if (Watch.Addr < (Page.Page + FEXCore::Core::PAGE_SIZE) && (Watch.Addr + Watch.Length) > Page.Page) {
+          Used = true;
+          break;
+        }
+      }
+
+      if (Used) {
+        ++i;
+        continue;
+      }
+
+      ProtectWatchedPage(Page, false);
+      Page = WatchedPages[NumWatchedPages - 1];
+      NumWatchedPages.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    ProtectWatchedPages(true);
+  }
+
+  return {"OK", HandledPacketType::TYPE_ACK};
+}
+
 GdbServer::HandledPacketType GdbServer::handleBreakpoint(const std::string &packet) {
   auto ss = std::istringstream(packet);
 
+  // Z<type>,<addr>,<kind>
   bool Set{};
   uint64_t Addr;
   uint64_t Type;
+  uint64_t Kind;
   Set = ss.get() == 'Z';
 
+  ss >> std::hex >> Type;
+  ss.get(); // discard comma
   ss >> std::hex >> Addr;
   ss.get(); // discard comma
-  ss >> std::hex >> Type;
+  ss >> std::hex >> Kind;
+
+  if (ss.fail()) {
+    return {"E00", HandledPacketType::TYPE_ACK};
+  }
 
   CTX->Pause();
-  return {"OK", HandledPacketType::TYPE_ACK};
+
+  switch (Type) {
+    case 0: // Software breakpoint
+    case 1: // Hardware breakpoint
+      // Both are handled by the frontend, there is no guest code to patch
+      if (Set) {
+        CTX->AddBreakpoint(Addr);
+      }
+      else {
+        CTX->RemoveBreakpoint(Addr);
+      }
+      return {"OK", HandledPacketType::TYPE_ACK};
+    case 2: // Write watchpoint
+    case 3: // Read watchpoint
+    case 4: // Access watchpoint
+      // Kind is the length of the watched region
+      return handleWatchpoint(Set, Type, Addr, Kind);
+    default:
+      return {"", HandledPacketType::TYPE_UNKNOWN};
+  }
 }
 
 GdbServer::HandledPacketType GdbServer::ProcessPacket(const std::string &packet) {
@@ -865,6 +1239,7 @@ GdbServer::HandledPacketType GdbServer::ProcessPacket(const std::string &packet)
     case 'T': // Is a thread alive?
       return {"OK", HandledPacketType::TYPE_ACK};
     case 'Z': // Inserts breakpoint or watchpoint
+    case 'z': // Removes breakpoint or watchpoint
       return handleBreakpoint(packet);
     case 'k': // Kill the process
       CTX->Stop(false /* Ignore current thread */);
@@ -13,7 +13,9 @@ $end_info$
 
 #include <FEXCore/Utils/Threads.h>
 
-#include <mutex>
+#include <array>
+#include <atomic>
+#include <signal.h>
 
 namespace FEXCore {
 
@@ -24,8 +26,32 @@ public:
     // Public for threading
     void GdbServerLoop();
 
+    /**
+     * @name Watchpoint suspension
+     *
+     * Nests, the pages are protected again once every suspender has resumed.
+     * Safe to call from a signal handler.
+     * @{ */
+    void SuspendWatchpoints();
+    void ResumeWatchpoints();
+    /**  @} */
+
+    // Refreshes the protection that watched pages in the range go back to once they are no longer watched
+    void GuestMappingChanged(uint64_t Start, uint64_t Length);
+
+    /**
+     * @brief Decides if a debug stop needs to reach the debugger, called with every thread idle
+     *
+     * @param WatchpointStop The stop came from a fault on a watched page
+     *
+     * @return false if the fault was on an unwatched address and the guest can carry on
+     */
+    bool ShouldReportDebugStop(bool WatchpointStop);
+
 private:
     void Break(int signal);
+    void ReportDebugStop();
+    void PrepareResume();
 
     std::unique_ptr<std::iostream> OpenSocket();
     void StartThread();
@@ -55,6 +81,7 @@ private:
     HandledPacketType handleV(const std::string& packet);
     HandledPacketType handleThreadOp(const std::string &packet);
     HandledPacketType handleBreakpoint(const std::string &packet);
+    HandledPacketType handleWatchpoint(bool Set, uint64_t Type, uint64_t Addr, uint64_t Length);
     HandledPacketType handleProgramOffsets();
 
     std::string readRegs();
@@ -69,6 +96,57 @@ private:
     std::string ThreadString{};
     uint32_t CurrentDebuggingThread{};
     FEX_CONFIG_OPT(Filename, APP_FILENAME);
+
+    // Data watchpoints protect the pages they live in and catch the access in the SIGSEGV handler.
+    // The handler can run on any thread at any time, so everything it looks at is fixed size and guarded by ProtectLock.
+    // gdb falls back to software watchpoints once inserting one fails.
+    static constexpr size_t MaxWatchpoints = 16;
+    static constexpr size_t MaxWatchedPages = 64;
+
+    struct Watchpoint {
+      uint64_t Addr;
+      uint64_t Length;
+      // GDB Z packet type. 2 = write, 3 = read, 4 = access
+      uint64_t Type;
+    };
+
+    struct WatchedPage {
+      uint64_t Page;
+      // What the page goes back to when it isn't protected, -1 if the guest unmapped it
+      int Protection;
+      bool Armed;
+    };
+
+    // Spin lock that blocks host signals while held, so a signal handler on the same thread never waits on itself
+    class ScopedProtectLock final {
+    public:
+      ScopedProtectLock(GdbServer *Server);
+      ~ScopedProtectLock();
+    private:
+      GdbServer *Server;
+      sigset_t OldMask;
+    };
+    std::atomic_flag ProtectLock = ATOMIC_FLAG_INIT;
+
+    std::array<Watchpoint, MaxWatchpoints> Watchpoints{};
+    size_t NumWatchpoints{};
+    std::array<WatchedPage, MaxWatchedPages> WatchedPages{};
+    // Read without the lock to keep syscalls cheap when nothing is watched
+    std::atomic<size_t> NumWatchedPages{};
+
+    // Host accesses to guest memory in progress
+    uint32_t SuspendCount{};
+
+    // The first watchpoint hit since the guest was resumed, Type zero if there wasn't one
+    Watchpoint WatchpointHit{};
+    uint64_t WatchpointHitAddr{};
+    bool WatchpointsNeedRearm{};
+    FEXCore::Context::CoreRunningMode ModeBeforeFault{};
+
+    bool HandleWatchpointFault(FEXCore::Core::InternalThreadState *Thread, uint64_t FaultAddr);
+    // Both need ProtectLock held
+    void ProtectWatchedPage(WatchedPage &Page, bool Arm);
+    void ProtectWatchedPages(bool Arm);
 };
 
 }
@@ -1,26 +1,164 @@
 #include "Interface/Core/HostFeatures.h"
 
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <map>
+#include <string>
+#include <string_view>
+
 #ifdef _M_ARM_64
 #include "aarch64/assembler-aarch64.h"
 #include "aarch64/cpu-aarch64.h"
 #include "aarch64/disasm-aarch64.h"
 #include "aarch64/assembler-aarch64.h"
+
+#include <cstdlib>
+#include <fstream>
 #endif
 
 #ifdef _M_X86_64
 #include <xbyak/xbyak_util.h>
+#include <cpuid.h>
 #endif
 
 namespace FEXCore {
 
+#ifdef _M_ARM_64
+static uint64_t GetCycleCounterFrequency() {
+  uint64_t Result{};
+  __asm("mrs %[Res], CNTFRQ_EL0"
+      : [Res] "=r" (Result));
+  return Result;
+}
+
+// The Snapdragon 865's big cores are Cortex-A77, any of them in the system rules out RCPC
+// Offline cores still have their MIDR readable, so every possible CPU is checked.
+// If none of them can be read we can't rule it out either
+static bool MayHaveCortexA77() {
+  constexpr uint64_t IMPLEMENTER_ARM = 0x41;
+  constexpr uint64_t PART_CORTEX_A77 = 0xD0D;
+
+  std::ifstream Possible("/sys/devices/system/cpu/possible");
+  std::string CPUList;
+  if (!std::getline(Possible, CPUList)) {
+    return true;
+  }
+
+  bool FoundMIDR = false;
+  std::string_view Ranges = CPUList;
+  while (!Ranges.empty()) {
+    // Comma separated list of single CPUs or inclusive ranges, "0-3,6"
+    auto End = Ranges.find(',');
+    auto Range = Ranges.substr(0, End);
+    Ranges = End == std::string_view::npos ? std::string_view{} : Ranges.substr(End + 1);
+
+    auto Dash = Range.find('-');
+    size_t First = std::strtoul(std::string(Range.substr(0, Dash)).c_str(), nullptr, 10);
+    size_t Last = Dash == std::string_view::npos ? First : std::strtoul(std::string(Range.substr(Dash + 1)).c_str(), nullptr, 10);
+
+    for (size_t CPU = First; CPU <= Last; ++CPU) {
+      std::ifstream File("/sys/devices/system/cpu/cpu" + std::to_string(CPU) + "/regs/identification/midr_el1");
+      uint64_t MIDR{};
+      if (!(File >> std::hex >> MIDR)) {
+        continue;
+      }
+
+      FoundMIDR = true;
+      uint64_t Implementer = (MIDR >> 24) & 0xFF;
+      uint64_t Part = (MIDR >> 4) & 0xFFF;
+      if (Implementer == IMPLEMENTER_ARM && Part == PART_CORTEX_A77) {
+        return true;
+      }
+    }
+  }
+
+  return !FoundMIDR;
+}
+#else
+static uint64_t GetCycleCounterFrequency() {
+  uint32_t eax, ebx, ecx, edx;
+  __cpuid(0, eax, ebx, ecx, edx);
+  if (eax >= 0x15) {
+    __cpuid(0x15, eax, ebx, ecx, edx);
+
+    if (eax && ebx && ecx) {
+      return static_cast<uint64_t>(ecx) * ebx / eax;
+    }
+  }
+  return 0;
+}
+#endif
+
+static const std::map<std::string_view, bool HostFeatures::*, std::less<>> FeatureNames = {
+  {"aes",    &HostFeatures::SupportsAES},
+  {"pmull",  &HostFeatures::SupportsPMULL_128Bit},
+  {"sha",    &HostFeatures::SupportsSHA},
+  {"crc32",  &HostFeatures::SupportsCRC},
+  {"rng",    &HostFeatures::SupportsRAND},
+  {"lse",    &HostFeatures::SupportsAtomics},
+  {"rcpc",   &HostFeatures::SupportsRCPC},
+  {"rcpc2",  &HostFeatures::SupportsTSOImm9},
+};
+
 HostFeatures::HostFeatures() {
+  CycleCounterFrequency = GetCycleCounterFrequency();
+
 #ifdef _M_ARM_64
   auto Features = vixl::CPUFeatures::InferFromOS();
   SupportsAES = Features.Has(vixl::CPUFeatures::Feature::kAES);
+  SupportsPMULL_128Bit = Features.Has(vixl::CPUFeatures::Feature::kPmull1Q);
+  SupportsSHA = Features.Has(vixl::CPUFeatures::Feature::kSHA1) &&
+                Features.Has(vixl::CPUFeatures::Feature::kSHA2);
+  SupportsCRC = Features.Has(vixl::CPUFeatures::Feature::kCRC32);
+  SupportsRAND = Features.Has(vixl::CPUFeatures::Feature::kRNG);
+  SupportsAtomics = Features.Has(vixl::CPUFeatures::Feature::kAtomics);
+  // RCPC is bugged on Snapdragon 865
+  // Causes glibc cond16 test to immediately throw assert
+  // __pthread_mutex_cond_lock: Assertion `mutex->__data.__owner == 0'
+  SupportsRCPC = Features.Has(vixl::CPUFeatures::Feature::kRCpc) && !MayHaveCortexA77();
+  // LRCPC2 only shows up on cores newer than the Snapdragon 865
+  SupportsTSOImm9 = Features.Has(vixl::CPUFeatures::Feature::kRCpcImm);
 #endif
 #ifdef _M_X86_64
   Xbyak::util::Cpu Features{};
   SupportsAES = Features.has(Xbyak::util::Cpu::tAESNI);
+  SupportsPMULL_128Bit = Features.has(Xbyak::util::Cpu::tPCLMULQDQ);
+  SupportsSHA = Features.has(Xbyak::util::Cpu::tSHA);
+  SupportsCRC = Features.has(Xbyak::util::Cpu::tSSE42);
+  SupportsRAND = Features.has(Xbyak::util::Cpu::tRDRAND);
+  // TSO accesses are regular moves here
+  SupportsTSOImm9 = true;
 #endif
+
+  FEX_CONFIG_OPT(DisableHostFeatures, DISABLEHOSTFEATURES);
+  auto DisabledList = DisableHostFeatures();
+  std::string_view Disabled = DisabledList;
+  while (!Disabled.empty()) {
+    auto End = Disabled.find(',');
+    auto Name = Disabled.substr(0, End);
+    Disabled = End == std::string_view::npos ? std::string_view{} : Disabled.substr(End + 1);
+
+    if (Name.empty()) {
+      continue;
+    }
+
+    auto Feature = FeatureNames.find(Name);
+    if (Feature != FeatureNames.end()) {
+      this->*Feature->second = false;
+    }
+    else {
+      LogMan::Msg::EFmt("Unknown host feature: '{}'", Name);
+    }
+  }
+}
+
+uint64_t HostFeatures::GetFeatureBits() const {
+  uint64_t Bits{};
+  uint64_t Bit{};
+  for (auto &[Name, Feature] : FeatureNames) {
+    Bits |= static_cast<uint64_t>(this->*Feature) << Bit++;
+  }
+  return Bits;
 }
 }
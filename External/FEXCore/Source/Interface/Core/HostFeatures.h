@@ -1,9 +1,35 @@
 #pragma once
+#include <stdint.h>
 
 namespace FEXCore {
+/**
+ * @brief Host CPU features that the backends and the CPUID emulation make decisions on
+ *
+ * Features named in the DisableHostFeatures config option are masked off after detection,
+ * so the fallback paths can be exercised on a host that has everything.
+ */
 class HostFeatures final {
   public:
     HostFeatures();
+
+    // One bit per named feature after masking, for keying anything that bakes in feature checks
+    uint64_t GetFeatureBits() const;
+
     bool SupportsAES{};
+    bool SupportsPMULL_128Bit{};
+    // SHA1 and SHA256
+    bool SupportsSHA{};
+    bool SupportsCRC{};
+    bool SupportsRAND{};
+
+    // FEAT_LSE
+    bool SupportsAtomics{};
+    // FEAT_LRCPC
+    bool SupportsRCPC{};
+    // TSO memory accesses can carry a signed 9bit immediate offset (FEAT_LRCPC2 on Arm64)
+    bool SupportsTSOImm9{};
+
+    // Frequency of the counter backing the CycleCounter IR op, zero if unknown
+    uint64_t CycleCounterFrequency{};
 };
 }
@@ -27,9 +27,12 @@
 #include <limits>
 #include <vector>
 #ifdef _M_X86_64
+#include <x86intrin.h>
 #include <xmmintrin.h>
 #endif
+#include <sys/random.h>
 #include <unistd.h>
+#include <xxhash.h>
 
 namespace FEXCore::CPU {
 
@@ -476,6 +479,52 @@ namespace AES {
   }
 }
 
+namespace SHA {
+  static uint32_t Rol(uint32_t In, uint32_t R) {
+    return (In << R) | (In >> (32 - R));
+  }
+
+  static uint32_t Ror(uint32_t In, uint32_t R) {
+    return (In >> R) | (In << (32 - R));
+  }
+
+  static uint32_t F(uint32_t Function, uint32_t B, uint32_t C, uint32_t D) {
+    switch (Function) {
+      case 0: return (B & C) ^ (~B & D);
+      case 2: return (B & C) ^ (B & D) ^ (C & D);
+      default: return B ^ C ^ D;
+    }
+  }
+
+  static constexpr uint32_t K[4] = {
+    0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6,
+  };
+
+  static uint32_t Ch(uint32_t E, uint32_t F, uint32_t G) {
+    return (E & F) ^ (~E & G);
+  }
+
+  static uint32_t Maj(uint32_t A, uint32_t B, uint32_t C) {
+    return (A & B) ^ (A & C) ^ (B & C);
+  }
+
+  static uint32_t Sigma0(uint32_t A) {
+    return Ror(A, 2) ^ Ror(A, 13) ^ Ror(A, 22);
+  }
+
+  static uint32_t Sigma1(uint32_t E) {
+    return Ror(E, 6) ^ Ror(E, 11) ^ Ror(E, 25);
+  }
+
+  static uint32_t MsgSigma0(uint32_t W) {
+    return Ror(W, 7) ^ Ror(W, 18) ^ (W >> 3);
+  }
+
+  static uint32_t MsgSigma1(uint32_t W) {
+    return Ror(W, 17) ^ Ror(W, 19) ^ (W >> 10);
+  }
+}
+
 template<typename unsigned_type, typename signed_type, typename float_type>
 bool IsConditionTrue(uint8_t Cond, uint64_t Src1, uint64_t Src2) {
   bool CompResult = false;
@@ -1094,7 +1143,7 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
   uintptr_t ListBegin = CurrentIR->GetListData();
   uintptr_t DataBegin = CurrentIR->GetData();
 
-  static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
+  static_assert(sizeof(FEXCore::IR::IROp_Header) == 5);
   static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
 
   auto BlockIterator = CurrentIR->GetBlocks().begin();
@@ -1137,7 +1186,7 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             auto Op = IROp->C<IR::IROp_ValidateCode>();
 
             auto CodePtr = Entry + Op->Offset;
-            if (memcmp((void*)CodePtr, &Op->CodeOriginalLow, Op->CodeLength) != 0) {
+            if (XXH3_64bits((void*)CodePtr, Op->CodeLength) != Op->CodeHash) {
               GD = 1;
             } else {
               GD = 0;
@@ -1150,6 +1199,11 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             break;
           }
 
+          case IR::OP_DEBUGBREAKPOINT: {
+            FEXCore::Context::Context::HandleDebugBreakpoint(Thread->CurrentFrame);
+            break;
+          }
+
           case IR::OP_DUMMY:
           case IR::OP_BEGINBLOCK:
           case IR::OP_ENDBLOCK:
@@ -1171,6 +1225,16 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             }
             break;
           }
+          case IR::OP_YIELD:
+          case IR::OP_SPINWAIT: {
+            // The interpreter has no cheap way to wait on memory, just hint the host
+            #ifdef _M_ARM_64
+              __asm volatile("yield");
+            #else
+              _mm_pause();
+            #endif
+            break;
+          }
           case IR::OP_EXITFUNCTION: {
             auto Op = IROp->C<IR::IROp_ExitFunction>();
             uintptr_t* ContextPtr = reinterpret_cast<uintptr_t*>(Thread->CurrentFrame);
@@ -1282,13 +1346,31 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
           case IR::OP_CYCLECOUNTER: {
             #ifdef DEBUG_CYCLES
               GD = 0;
+            #elif defined(_M_ARM_64)
+              // Same counter as the JIT so the frequency matches what CPUID reports
+              uint64_t Result{};
+              __asm volatile("mrs %[Res], CNTVCT_EL0"
+                  : [Res] "=r" (Result));
+              GD = Result;
             #else
-              timespec time;
-              clock_gettime(CLOCK_REALTIME, &time);
-              GD = time.tv_nsec + time.tv_sec * 1000000000;
+              GD = __rdtsc();
             #endif
             break;
           }
+          case IR::OP_RDRAND: {
+            uint64_t *DstPtr = GetDest<uint64_t*>(SSAData, WrapperOp);
+            uint64_t Value{};
+            // The kernel's pool stands in for the hardware source, a short read is a failed RDRAND
+            if (getrandom(&Value, sizeof(Value), GRND_NONBLOCK) == sizeof(Value)) {
+              DstPtr[0] = Value;
+              DstPtr[1] = 1;
+            }
+            else {
+              DstPtr[0] = 0;
+              DstPtr[1] = 0;
+            }
+            break;
+          }
           case IR::OP_MOV: {
             auto Op = IROp->C<IR::IROp_Mov>();
             memcpy(GDP, GetSrc<void*>(SSAData, Op->Header.Args[0]), OpSize);
@@ -1651,6 +1733,54 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             CacheLineFlush(Data);
             break;
           }
+          case IR::OP_CACHELINECLEAN: {
+            auto Op = IROp->C<IR::IROp_CacheLineClean>();
+
+            char *Data = *GetSrc<char **>(SSAData, Op->Addr);
+
+            // A flush is always a valid write back
+            CacheLineFlush(Data);
+            break;
+          }
+          case IR::OP_PREFETCH: {
+            // Only a hint
+            break;
+          }
+          case IR::OP_STOREMEMNONTEMPORAL: {
+            auto Op = IROp->C<IR::IROp_StoreMemNonTemporal>();
+
+            void *Data = *GetSrc<void **>(SSAData, Op->Addr);
+            memcpy(Data, GetSrc<void*>(SSAData, Op->Value), Op->Size);
+            break;
+          }
+          case IR::OP_STRINGSCAN16: {
+            auto Op = IROp->C<IR::IROp_StringScan16>();
+            uint8_t const *Data = *GetSrc<uint8_t const**>(SSAData, Op->Addr);
+            uint8_t Value = *GetSrc<uint8_t*>(SSAData, Op->Value);
+
+            uint64_t Index = 0;
+            for (; Index < 16; ++Index) {
+              if ((Data[Index] == Value) == Op->MatchEqual) {
+                break;
+              }
+            }
+            GD = Index;
+            break;
+          }
+          case IR::OP_STRINGCOMPARE16: {
+            auto Op = IROp->C<IR::IROp_StringCompare16>();
+            uint8_t const *Data1 = *GetSrc<uint8_t const**>(SSAData, Op->Addr1);
+            uint8_t const *Data2 = *GetSrc<uint8_t const**>(SSAData, Op->Addr2);
+
+            uint64_t Index = 0;
+            for (; Index < 16; ++Index) {
+              if ((Data1[Index] == Data2[Index]) == Op->MatchEqual) {
+                break;
+              }
+            }
+            GD = Index;
+            break;
+          }
 
           #define DO_OP(size, type, func)              \
             case size: {                                      \
@@ -2050,6 +2180,19 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             GD = std::popcount(Src);
             break;
           }
+          case IR::OP_CRC32: {
+            auto Op = IROp->C<IR::IROp_CRC32>();
+            uint32_t Crc = *GetSrc<uint32_t*>(SSAData, Op->Crc);
+            uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Src);
+
+            // Reflected CRC32C, one bit at a time
+            for (size_t i = 0; i < Op->SrcSize * 8; ++i) {
+              Crc ^= (Src >> i) & 1;
+              Crc = (Crc >> 1) ^ (0x82F63B78U & -(Crc & 1));
+            }
+            GD = Crc;
+            break;
+          }
           case IR::OP_FINDLSB: {
             auto Op = IROp->C<IR::IROp_FindLSB>();
             uint64_t Src = *GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
@@ -2637,34 +2780,6 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             break;
           }
           // Vector ops
-          case IR::OP_CREATEVECTOR2: {
-            auto Op = IROp->C<IR::IROp_CreateVector2>();
-            LOGMAN_THROW_A_FMT(OpSize <= 16, "Can't handle a vector of size: {}", OpSize);
-            void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(SSAData, Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t ElementSize = OpSize / 2;
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src1_d = reinterpret_cast<type*>(Src1); \
-                auto *Src2_d = reinterpret_cast<type*>(Src2); \
-                Dst_d[0] = *Src1_d; \
-                Dst_d[1] = *Src2_d; \
-                break; \
-              }
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", ElementSize); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
           case IR::OP_SPLATVECTOR4:
           case IR::OP_SPLATVECTOR2: {
             auto Op = IROp->C<IR::IROp_SplatVector2>();
@@ -4082,6 +4197,41 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             break;
           }
 
+          case IR::OP_VTRN2:
+          case IR::OP_VTRN: {
+            auto Op = IROp->C<IR::IROp_VTrn>();
+            auto Src1 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+            auto Src2 = GetSrc<uint8_t*>(SSAData, Op->Header.Args[1]);
+            uint8_t Tmp[16];
+            uint8_t ElementSize = Op->Header.ElementSize;
+            uint8_t Elements = OpSize / ElementSize;
+            unsigned Start = IROp->Op == IR::OP_VTRN ? 0 : 1;
+
+            for (unsigned i = 0; i < Elements; i += 2) {
+              memcpy(&Tmp[i * ElementSize], &Src1[(i + Start) * ElementSize], ElementSize);
+              memcpy(&Tmp[(i + 1) * ElementSize], &Src2[(i + Start) * ElementSize], ElementSize);
+            }
+
+            memcpy(GDP, Tmp, OpSize);
+            break;
+          }
+
+          case IR::OP_VREV64: {
+            auto Op = IROp->C<IR::IROp_VRev64>();
+            auto Src = GetSrc<uint8_t*>(SSAData, Op->Header.Args[0]);
+            uint8_t Tmp[16];
+            uint8_t ElementSize = Op->Header.ElementSize;
+            uint8_t Elements = OpSize / ElementSize;
+            uint8_t ElementsPer64 = 8 / ElementSize;
+
+            for (unsigned i = 0; i < Elements; ++i) {
+              memcpy(&Tmp[i * ElementSize], &Src[(i ^ (ElementsPer64 - 1)) * ElementSize], ElementSize);
+            }
+
+            memcpy(GDP, Tmp, OpSize);
+            break;
+          }
+
           case IR::OP_VINSELEMENT: {
             auto Op = IROp->C<IR::IROp_VInsElement>();
             void *Src1 = GetSrc<void*>(SSAData, Op->Header.Args[0]);
@@ -5036,6 +5186,145 @@ void InterpreterOps::InterpretIR(FEXCore::Core::InternalThreadState *Thread, uin
             memcpy(GDP, &Tmp, sizeof(Tmp));
             break;
           }
+          case IR::OP_VPCLMULQDQ: {
+            auto Op = IROp->C<IR::IROp_VPCLMULQDQ>();
+            uint64_t *Src1 = GetSrc<uint64_t*>(SSAData, Op->Header.Args[0]);
+            uint64_t *Src2 = GetSrc<uint64_t*>(SSAData, Op->Header.Args[1]);
+
+            uint64_t A = Src1[Op->Selector & 1];
+            uint64_t B = Src2[(Op->Selector >> 4) & 1];
+
+            __uint128_t Tmp{};
+            for (size_t i = 0; i < 64; ++i) {
+              if ((B >> i) & 1) {
+                Tmp ^= static_cast<__uint128_t>(A) << i;
+              }
+            }
+            memcpy(GDP, &Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA1RNDS4: {
+            auto Op = IROp->C<IR::IROp_VSha1Rnds4>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+            // A is in the top element and W0 has E already added to it
+            uint32_t A = Src1[3];
+            uint32_t B = Src1[2];
+            uint32_t C = Src1[1];
+            uint32_t D = Src1[0];
+            uint32_t E = 0;
+
+            for (size_t i = 0; i < 4; ++i) {
+              uint32_t NewA = SHA::F(Op->Function, B, C, D) + SHA::Rol(A, 5) + Src2[3 - i] + E + SHA::K[Op->Function];
+              E = D;
+              D = C;
+              C = SHA::Rol(B, 30);
+              B = A;
+              A = NewA;
+            }
+
+            uint32_t Tmp[4] = {D, C, B, A};
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA1NEXTE: {
+            auto Op = IROp->C<IR::IROp_VSha1NextE>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+            uint32_t Tmp[4] = {Src2[0], Src2[1], Src2[2], Src2[3] + SHA::Rol(Src1[3], 30)};
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA1MSG1: {
+            auto Op = IROp->C<IR::IROp_VSha1Msg1>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+            uint32_t Tmp[4] = {
+              Src1[0] ^ Src2[2],
+              Src1[1] ^ Src2[3],
+              Src1[2] ^ Src1[0],
+              Src1[3] ^ Src1[1],
+            };
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA1MSG2: {
+            auto Op = IROp->C<IR::IROp_VSha1Msg2>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+            uint32_t W16 = SHA::Rol(Src1[3] ^ Src2[2], 1);
+            uint32_t W17 = SHA::Rol(Src1[2] ^ Src2[1], 1);
+            uint32_t W18 = SHA::Rol(Src1[1] ^ Src2[0], 1);
+            uint32_t W19 = SHA::Rol(Src1[0] ^ W16, 1);
+
+            uint32_t Tmp[4] = {W19, W18, W17, W16};
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA256RNDS2: {
+            auto Op = IROp->C<IR::IROp_VSha256Rnds2>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+            uint32_t *WK = GetSrc<uint32_t*>(SSAData, Op->Header.Args[2]);
+
+            uint32_t A = Src2[3];
+            uint32_t B = Src2[2];
+            uint32_t C = Src1[3];
+            uint32_t D = Src1[2];
+            uint32_t E = Src2[1];
+            uint32_t F = Src2[0];
+            uint32_t G = Src1[1];
+            uint32_t H = Src1[0];
+
+            for (size_t i = 0; i < 2; ++i) {
+              uint32_t T1 = H + SHA::Sigma1(E) + SHA::Ch(E, F, G) + WK[i];
+              uint32_t T2 = SHA::Sigma0(A) + SHA::Maj(A, B, C);
+              H = G;
+              G = F;
+              F = E;
+              E = D + T1;
+              D = C;
+              C = B;
+              B = A;
+              A = T1 + T2;
+            }
+
+            uint32_t Tmp[4] = {F, E, B, A};
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA256MSG1: {
+            auto Op = IROp->C<IR::IROp_VSha256Msg1>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+            uint32_t Tmp[4] = {
+              Src1[0] + SHA::MsgSigma0(Src1[1]),
+              Src1[1] + SHA::MsgSigma0(Src1[2]),
+              Src1[2] + SHA::MsgSigma0(Src1[3]),
+              Src1[3] + SHA::MsgSigma0(Src2[0]),
+            };
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
+          case IR::OP_VSHA256MSG2: {
+            auto Op = IROp->C<IR::IROp_VSha256Msg2>();
+            uint32_t *Src1 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[0]);
+            uint32_t *Src2 = GetSrc<uint32_t*>(SSAData, Op->Header.Args[1]);
+
+            uint32_t W16 = Src1[0] + SHA::MsgSigma1(Src2[2]);
+            uint32_t W17 = Src1[1] + SHA::MsgSigma1(Src2[3]);
+            uint32_t W18 = Src1[2] + SHA::MsgSigma1(W16);
+            uint32_t W19 = Src1[3] + SHA::MsgSigma1(W17);
+
+            uint32_t Tmp[4] = {W16, W17, W18, W19};
+            memcpy(GDP, Tmp, sizeof(Tmp));
+            break;
+          }
           case IR::OP_F80LOADFCW: {
             OpHandlers<IR::OP_F80LOADFCW>::handle(*GetSrc<uint16_t*>(SSAData, IROp->Args[0]));
             break;
@@ -80,6 +80,19 @@ DEF_OP(CycleCounter) {
 #endif
 }
 
+DEF_OP(RDRAND) {
+  auto Dst = GetSrcPair<RA_64>(Node);
+  if (CTX->HostFeatures.SupportsRAND) {
+    mrs(Dst.first, RNDR);
+    // NZCV is 0b0100 on failure
+    cset(Dst.second, ne);
+  }
+  else {
+    movz(Dst.first, 0);
+    movz(Dst.second, 0);
+  }
+}
+
 #define GRS(Node) (IROp->Size <= 4 ? GetReg<RA_32>(Node) : GetReg<RA_64>(Node))
 
 DEF_OP(Add) {
@@ -520,11 +533,25 @@ DEF_OP(LDiv) {
     break;
     }
     case 8: {
+      auto Lower = GetReg<RA_64>(Op->Header.Args[0].ID());
+      auto Upper = GetReg<RA_64>(Op->Header.Args[1].ID());
+      auto Divisor = GetReg<RA_64>(Op->Header.Args[2].ID());
+
+      Label SlowPath;
+      Label Done;
+
+      // If the upper half is only the sign extension of the lower half then a 64bit divide is enough
+      cmp(Upper, Operand(Lower, ASR, 63));
+      b(&SlowPath, Condition::ne);
+      sdiv(GetReg<RA_64>(Node), Lower, Divisor);
+      b(&Done);
+
+      bind(&SlowPath);
       PushDynamicRegsAndLR();
 
-      mov(x0, GetReg<RA_64>(Op->Header.Args[1].ID()));
-      mov(x1, GetReg<RA_64>(Op->Header.Args[0].ID()));
-      mov(x2, GetReg<RA_64>(Op->Header.Args[2].ID()));
+      mov(x0, Upper);
+      mov(x1, Lower);
+      mov(x2, Divisor);
 
       LoadConstant(x3, reinterpret_cast<uint64_t>(LDIV));
       SpillStaticRegs();
@@ -537,6 +564,8 @@ DEF_OP(LDiv) {
 
       // Move result to its destination register
       mov(GetReg<RA_64>(Node), x0);
+
+      bind(&Done);
     break;
     }
     default: LOGMAN_MSG_A_FMT("Unknown LDIV Size: {}", Size); break;
@@ -563,11 +592,45 @@ DEF_OP(LUDiv) {
     break;
     }
     case 8: {
+      auto Lower = GetReg<RA_64>(Op->Header.Args[0].ID());
+      auto Upper = GetReg<RA_64>(Op->Header.Args[1].ID());
+      auto Divisor = GetReg<RA_64>(Op->Header.Args[2].ID());
+
+      Label SlowPath;
+      Label LongPath;
+      Label Done;
+
+      // If the upper half is zero then a 64bit divide is enough
+      cbnz(Upper, &LongPath);
+      udiv(GetReg<RA_64>(Node), Lower, Divisor);
+      b(&Done);
+
+      // A divisor that fits in 32bits can do the 128bit divide as two chained 96/32 divides
+      // The upper half needs to be smaller than the divisor, otherwise the quotient doesn't fit in 64bits and x86 faults
+      bind(&LongPath);
+      lsr(TMP1, Divisor, 32);
+      cbnz(TMP1, &SlowPath);
+      cmp(Upper, Divisor);
+      b(&SlowPath, Condition::hs);
+
+      // High 32bits of the quotient from Upper:Lower[63:32]
+      extr(TMP1, Upper, Lower, 32);
+      udiv(TMP2, TMP1, Divisor);
+      msub(TMP1, TMP2, Divisor, TMP1);
+
+      // Low 32bits of the quotient from Remainder:Lower[31:0]
+      lsl(TMP1, TMP1, 32);
+      bfxil(TMP1, Lower, 0, 32);
+      udiv(TMP3, TMP1, Divisor);
+      orr(GetReg<RA_64>(Node), TMP3, Operand(TMP2, LSL, 32));
+      b(&Done);
+
+      bind(&SlowPath);
       PushDynamicRegsAndLR();
 
-      mov(x0, GetReg<RA_64>(Op->Header.Args[1].ID()));
-      mov(x1, GetReg<RA_64>(Op->Header.Args[0].ID()));
-      mov(x2, GetReg<RA_64>(Op->Header.Args[2].ID()));
+      mov(x0, Upper);
+      mov(x1, Lower);
+      mov(x2, Divisor);
 
       LoadConstant(x3, reinterpret_cast<uint64_t>(LUDIV));
       SpillStaticRegs();
@@ -580,6 +643,8 @@ DEF_OP(LUDiv) {
 
       // Move result to its destination register
       mov(GetReg<RA_64>(Node), x0);
+
+      bind(&Done);
     break;
     }
     default: LOGMAN_MSG_A_FMT("Unknown LUDIV Size: {}", Size); break;
@@ -616,11 +681,26 @@ DEF_OP(LRem) {
     break;
     }
     case 8: {
+      auto Lower = GetReg<RA_64>(Op->Header.Args[0].ID());
+      auto Upper = GetReg<RA_64>(Op->Header.Args[1].ID());
+      auto Divisor = GetReg<RA_64>(Op->Header.Args[2].ID());
+
+      Label SlowPath;
+      Label Done;
+
+      // If the upper half is only the sign extension of the lower half then a 64bit divide is enough
+      cmp(Upper, Operand(Lower, ASR, 63));
+      b(&SlowPath, Condition::ne);
+      sdiv(TMP1, Lower, Divisor);
+      msub(GetReg<RA_64>(Node), TMP1, Divisor, Lower);
+      b(&Done);
+
+      bind(&SlowPath);
       PushDynamicRegsAndLR();
 
-      mov(x0, GetReg<RA_64>(Op->Header.Args[1].ID()));
-      mov(x1, GetReg<RA_64>(Op->Header.Args[0].ID()));
-      mov(x2, GetReg<RA_64>(Op->Header.Args[2].ID()));
+      mov(x0, Upper);
+      mov(x1, Lower);
+      mov(x2, Divisor);
 
       LoadConstant(x3, reinterpret_cast<uint64_t>(LREM));
       SpillStaticRegs();
@@ -633,6 +713,8 @@ DEF_OP(LRem) {
 
       // Move result to its destination register
       mov(GetReg<RA_64>(Node), x0);
+
+      bind(&Done);
     break;
     }
     default: LOGMAN_MSG_A_FMT("Unknown LREM Size: {}", Size); break;
@@ -665,12 +747,46 @@ DEF_OP(LURem) {
     break;
     }
     case 8: {
+      auto Lower = GetReg<RA_64>(Op->Header.Args[0].ID());
+      auto Upper = GetReg<RA_64>(Op->Header.Args[1].ID());
+      auto Divisor = GetReg<RA_64>(Op->Header.Args[2].ID());
+
+      Label SlowPath;
+      Label LongPath;
+      Label Done;
+
+      // If the upper half is zero then a 64bit divide is enough
+      cbnz(Upper, &LongPath);
+      udiv(TMP1, Lower, Divisor);
+      msub(GetReg<RA_64>(Node), TMP1, Divisor, Lower);
+      b(&Done);
+
+      // A divisor that fits in 32bits can do the 128bit divide as two chained 96/32 divides
+      // The upper half needs to be smaller than the divisor, otherwise the quotient doesn't fit in 64bits and x86 faults
+      bind(&LongPath);
+      lsr(TMP1, Divisor, 32);
+      cbnz(TMP1, &SlowPath);
+      cmp(Upper, Divisor);
+      b(&SlowPath, Condition::hs);
+
+      // High 32bits of the quotient from Upper:Lower[63:32]
+      extr(TMP1, Upper, Lower, 32);
+      udiv(TMP2, TMP1, Divisor);
+      msub(TMP1, TMP2, Divisor, TMP1);
 
+      // Low 32bits of the quotient from Remainder:Lower[31:0]
+      lsl(TMP1, TMP1, 32);
+      bfxil(TMP1, Lower, 0, 32);
+      udiv(TMP3, TMP1, Divisor);
+      msub(GetReg<RA_64>(Node), TMP3, Divisor, TMP1);
+      b(&Done);
+
+      bind(&SlowPath);
       PushDynamicRegsAndLR();
 
-      mov(x0, GetReg<RA_64>(Op->Header.Args[1].ID()));
-      mov(x1, GetReg<RA_64>(Op->Header.Args[0].ID()));
-      mov(x2, GetReg<RA_64>(Op->Header.Args[2].ID()));
+      mov(x0, Upper);
+      mov(x1, Lower);
+      mov(x2, Divisor);
 
       LoadConstant(x3, reinterpret_cast<uint64_t>(LUREM));
       SpillStaticRegs();
@@ -683,6 +799,8 @@ DEF_OP(LURem) {
       // Result is now in x0
       // Move result to its destination register
       mov(GetReg<RA_64>(Node), x0);
+
+      bind(&Done);
     break;
     }
     default: LOGMAN_MSG_A_FMT("Unknown LUREM Size: {}", OpSize); break;
@@ -737,6 +855,27 @@ DEF_OP(Popcount) {
   umov(Dst.W(), VTMP1.B(), 0);
 }
 
+DEF_OP(CRC32) {
+  auto Op = IROp->C<IR::IROp_CRC32>();
+  auto Dst = GetReg<RA_32>(Node);
+  auto Crc = GetReg<RA_32>(Op->Crc.ID());
+  switch (Op->SrcSize) {
+    case 1:
+      crc32cb(Dst, Crc, GetReg<RA_32>(Op->Src.ID()));
+      break;
+    case 2:
+      crc32ch(Dst, Crc, GetReg<RA_32>(Op->Src.ID()));
+      break;
+    case 4:
+      crc32cw(Dst, Crc, GetReg<RA_32>(Op->Src.ID()));
+      break;
+    case 8:
+      crc32cx(Dst, Crc, GetReg<RA_64>(Op->Src.ID()));
+      break;
+    default: LOGMAN_MSG_A_FMT("Unsupported CRC32 size: {}", Op->SrcSize);
+  }
+}
+
 DEF_OP(FindLSB) {
   auto Op = IROp->C<IR::IROp_FindLSB>();
   uint8_t OpSize = IROp->Size;
@@ -1066,6 +1205,7 @@ void Arm64JITCore::RegisterALUHandlers() {
   REGISTER_OP(INLINECONSTANT,    InlineConstant);
   REGISTER_OP(INLINEENTRYPOINTOFFSET,  InlineEntrypointOffset);
   REGISTER_OP(CYCLECOUNTER,      CycleCounter);
+  REGISTER_OP(RDRAND,            RDRAND);
   REGISTER_OP(ADD,               Add);
   REGISTER_OP(SUB,               Sub);
   REGISTER_OP(NEG,               Neg);
@@ -1091,6 +1231,7 @@ void Arm64JITCore::RegisterALUHandlers() {
   REGISTER_OP(LUREM,             LURem);
   REGISTER_OP(NOT,               Not);
   REGISTER_OP(POPCOUNT,          Popcount);
+  REGISTER_OP(CRC32,             CRC32);
   REGISTER_OP(FINDLSB,           FindLSB);
   REGISTER_OP(FINDMSB,           FindMSB);
   REGISTER_OP(FINDTRAILINGZEROS, FindTrailingZeros);
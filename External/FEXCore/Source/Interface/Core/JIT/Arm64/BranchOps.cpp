@@ -13,6 +13,8 @@ $end_info$
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <Interface/HLE/Thunks/Thunks.h>
 
+#include <xxhash.h>
+
 namespace FEXCore::CPU {
 using namespace vixl;
 using namespace vixl::aarch64;
@@ -69,6 +71,10 @@ DEF_OP(ExitFunction) {
 
   Label FullLookup;
 
+  if (SamplingData) {
+    EmitBlockExitSample();
+  }
+
   ResetStack();
 
   aarch64::Register RipReg;
@@ -166,16 +172,32 @@ DEF_OP(CondJump) {
     TrueTargetLabel = &TrueIter->second;
   }
 
+  if (FalseIter == JumpTargets.end()) {
+    FalseTargetLabel = &JumpTargets.try_emplace(Op->FalseBlock.ID()).first->second;
+  }
+  else {
+    FalseTargetLabel = &FalseIter->second;
+  }
+
+  // If the true block directly follows then branch on the inverted condition and fall through to it instead
+  bool Invert = Op->TrueBlock.ID() == NextBlockID && Op->FalseBlock.ID() != NextBlockID;
+  Label *BranchTargetLabel = Invert ? FalseTargetLabel : TrueTargetLabel;
 
   uint64_t Const;
   bool isConst = IsInlineConstant(Op->Cmp2, &Const);
 
   if (isConst && Const == 0 && Op->Cond.Val == FEXCore::IR::COND_EQ) {
     LOGMAN_THROW_A_FMT(IsGPR(Op->Cmp1.ID()), "CondJump: Expected GPR");
-    cbz(GRCMP(Op->Cmp1.ID()), TrueTargetLabel);
+    if (Invert)
+      cbnz(GRCMP(Op->Cmp1.ID()), BranchTargetLabel);
+    else
+      cbz(GRCMP(Op->Cmp1.ID()), BranchTargetLabel);
   } else if (isConst && Const == 0 && Op->Cond.Val == FEXCore::IR::COND_NEQ) {
     LOGMAN_THROW_A_FMT(IsGPR(Op->Cmp1.ID()), "CondJump: Expected GPR");
-    cbnz(GRCMP(Op->Cmp1.ID()), TrueTargetLabel);
+    if (Invert)
+      cbz(GRCMP(Op->Cmp1.ID()), BranchTargetLabel);
+    else
+      cbnz(GRCMP(Op->Cmp1.ID()), BranchTargetLabel);
   } else {
     if (IsGPR(Op->Cmp1.ID())) {
       if (isConst)
@@ -188,16 +210,12 @@ DEF_OP(CondJump) {
       LOGMAN_MSG_A_FMT("CondJump: Expected GPR or FPR");
     }
 
-    b(TrueTargetLabel, MapBranchCC(Op->Cond));
+    // Arm64 condition codes are exact complements when inverted, including for unordered float compares
+    auto CC = MapBranchCC(Op->Cond);
+    b(BranchTargetLabel, Invert ? InvertCondition(CC) : CC);
   }
 
-  if (FalseIter == JumpTargets.end()) {
-    FalseTargetLabel = &JumpTargets.try_emplace(Op->FalseBlock.ID()).first->second;
-  }
-  else {
-    FalseTargetLabel = &FalseIter->second;
-  }
-  PendingTargetLabel = FalseTargetLabel;
+  PendingTargetLabel = Invert ? TrueTargetLabel : FalseTargetLabel;
 }
 
 DEF_OP(Syscall) {
@@ -259,50 +277,92 @@ DEF_OP(Thunk) {
 
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
-  const auto *OldCode = (const uint8_t *)&Op->CodeOriginalLow;
-  int len = Op->CodeLength;
-  int idx = 0;
-
-  LoadConstant(GetReg<RA_64>(Node), 0);
-  LoadConstant(x0, Entry + Op->Offset);
-  LoadConstant(x1, 1);
-
-  while (len >= 8)
-  {
-    ldr(x2, MemOperand(x0, idx));
-    LoadConstant(x3, *(const uint32_t *)(OldCode + idx));
-    cmp(x2, x3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 8;
-    idx += 8;
+  auto Dst = GetReg<RA_64>(Node);
+  auto CodePtr = reinterpret_cast<uint8_t const*>(Entry + Op->Offset);
+  uint32_t Length = Op->CodeLength;
+  std::vector<uint8_t> Code(CodePtr, CodePtr + Length);
+
+  if (XXH3_64bits(Code.data(), Length) != Op->CodeHash) {
+    // The code already changed since it was decoded, this can only fail
+    LoadConstant(Dst, 1);
+    return;
   }
-  while (len >= 4)
-  {
-    ldr(w2, MemOperand(x0, idx));
-    LoadConstant(w3, *(const uint32_t *)(OldCode + idx));
-    cmp(w2, w3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 4;
-    idx += 4;
+
+  // Compare the guest code against a copy that lives right after this check.
+  // Walk it in the largest chunks that fit, the last chunk overlaps the one before it.
+  uint32_t ChunkSize = Length >= 16 ? 16 : Length >= 8 ? 8 : Length >= 4 ? 4 : Length >= 2 ? 2 : 1;
+  std::vector<uint32_t> Offsets;
+  for (uint32_t Offset = 0; Offset + ChunkSize < Length; Offset += ChunkSize) {
+    Offsets.emplace_back(Offset);
   }
-  while (len >= 2)
-  {
-    ldrh(w2, MemOperand(x0, idx));
-    LoadConstant(w3, *(const uint16_t *)(OldCode + idx));
-    cmp(w2, w3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 2;
-    idx += 2;
+  Offsets.emplace_back(Length - ChunkSize);
+
+  aarch64::Label Copy;
+  aarch64::Label PastCopy;
+  LoadConstant(TMP1, Entry + Op->Offset);
+  adr(TMP2, &Copy);
+
+  if (ChunkSize != 16) {
+    LoadConstant(Dst, 0);
   }
-  while (len >= 1)
-  {
-    ldrb(w2, MemOperand(x0, idx));
-    LoadConstant(w3, *(const uint8_t *)(OldCode + idx));
-    cmp(w2, w3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 1;
-    idx += 1;
+
+  for (size_t i = 0; i < Offsets.size(); ++i) {
+    // Step both pointers along to the next chunk
+    bool Last = i + 1 == Offsets.size();
+    int32_t Step = Last ? 0 : Offsets[i + 1] - Offsets[i];
+    auto Guest = MemOperand(TMP1, Step, Last ? aarch64::Offset : aarch64::PostIndex);
+    auto Original = MemOperand(TMP2, Step, Last ? aarch64::Offset : aarch64::PostIndex);
+
+    switch (ChunkSize) {
+      case 16:
+        ldr(VTMP1.Q(), Guest);
+        ldr(VTMP2.Q(), Original);
+        if (i == 0) {
+          eor(VTMP3.V16B(), VTMP1.V16B(), VTMP2.V16B());
+        }
+        else {
+          eor(VTMP1.V16B(), VTMP1.V16B(), VTMP2.V16B());
+          orr(VTMP3.V16B(), VTMP3.V16B(), VTMP1.V16B());
+        }
+        break;
+      case 8:
+        ldr(TMP3, Guest);
+        ldr(TMP4, Original);
+        break;
+      case 4:
+        ldr(TMP3.W(), Guest);
+        ldr(TMP4.W(), Original);
+        break;
+      case 2:
+        ldrh(TMP3.W(), Guest);
+        ldrh(TMP4.W(), Original);
+        break;
+      default:
+        ldrb(TMP3.W(), Guest);
+        ldrb(TMP4.W(), Original);
+        break;
+    }
+
+    if (ChunkSize != 16) {
+      eor(TMP3, TMP3, TMP4);
+      orr(Dst, Dst, TMP3);
+    }
+  }
+
+  if (ChunkSize == 16) {
+    // Any byte that differs leaves a non-zero byte behind
+    umaxv(VTMP3.B(), VTMP3.V16B());
+    fmov(Dst.W(), VTMP3.S());
+  }
+
+  b(&PastCopy);
+  bind(&Copy);
+  for (uint32_t i = 0; i < Length; i += 4) {
+    uint32_t Data{};
+    memcpy(&Data, &Code[i], std::min<uint32_t>(4, Length - i));
+    dc32(Data);
   }
+  bind(&PastCopy);
 }
 
 DEF_OP(RemoveCodeEntry) {
@@ -324,6 +384,23 @@ DEF_OP(RemoveCodeEntry) {
   PopDynamicRegsAndLR();
 }
 
+DEF_OP(DebugBreakpoint) {
+  // Arguments are passed as follows:
+  // X0: Thread
+
+  PushDynamicRegsAndLR();
+
+  mov(x0, STATE);
+
+  LoadConstant(x1, reinterpret_cast<uintptr_t>(&Context::Context::HandleDebugBreakpoint));
+  SpillStaticRegs();
+  blr(x1);
+  FillStaticRegs();
+
+  // Fix the stack and any values that were stepped on
+  PopDynamicRegsAndLR();
+}
+
 DEF_OP(CPUID) {
   auto Op = IROp->C<IR::IROp_CPUID>();
 
@@ -373,6 +450,7 @@ void Arm64JITCore::RegisterBranchHandlers() {
   REGISTER_OP(THUNK,             Thunk);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(REMOVECODEENTRY,   RemoveCodeEntry);
+  REGISTER_OP(DEBUGBREAKPOINT,   DebugBreakpoint);
   REGISTER_OP(CPUID,             CPUID);
 #undef REGISTER_OP
 }
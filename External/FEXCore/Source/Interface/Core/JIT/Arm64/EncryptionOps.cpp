@@ -88,6 +88,131 @@ DEF_OP(AESKeyGenAssist) {
   bind(&PastConstant);
 }
 
+DEF_OP(PCLMULQDQ) {
+  auto Op = IROp->C<IR::IROp_VPCLMULQDQ>();
+  auto Src1 = GetSrc(Op->Header.Args[0].ID());
+  auto Src2 = GetSrc(Op->Header.Args[1].ID());
+
+  switch (Op->Selector) {
+    case 0b0000'0000:
+      pmull(GetDst(Node).V1Q(), Src1.V1D(), Src2.V1D());
+      break;
+    case 0b0000'0001:
+      dup(VTMP1.V2D(), Src1.V2D(), 1);
+      pmull(GetDst(Node).V1Q(), VTMP1.V1D(), Src2.V1D());
+      break;
+    case 0b0001'0000:
+      dup(VTMP1.V2D(), Src2.V2D(), 1);
+      pmull(GetDst(Node).V1Q(), Src1.V1D(), VTMP1.V1D());
+      break;
+    case 0b0001'0001:
+      pmull2(GetDst(Node).V1Q(), Src1.V2D(), Src2.V2D());
+      break;
+    default:
+      LOGMAN_MSG_A_FMT("Unknown PCLMULQDQ selector: 0x{:x}", Op->Selector);
+      break;
+  }
+}
+
+// x86 stores the SHA state with the first element in the top of the register, Arm stores it in the bottom
+void Arm64JITCore::ReverseElements32(aarch64::VRegister const &Dst, aarch64::VRegister const &Src) {
+  rev64(Dst.V4S(), Src.V4S());
+  ext(Dst.V16B(), Dst.V16B(), Dst.V16B(), 8);
+}
+
+DEF_OP(SHA1Rnds4) {
+  auto Op = IROp->C<IR::IROp_VSha1Rnds4>();
+  constexpr uint32_t K[4] = {
+    0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6,
+  };
+
+  ReverseElements32(VTMP1, GetSrc(Op->Header.Args[0].ID()));
+  ReverseElements32(VTMP2, GetSrc(Op->Header.Args[1].ID()));
+
+  // x86 adds the round constant internally
+  LoadConstant(TMP1.W(), K[Op->Function]);
+  dup(VTMP3.V4S(), TMP1.W());
+  add(VTMP2.V4S(), VTMP2.V4S(), VTMP3.V4S());
+
+  // E is already added to the first message element, so E is zero here
+  eor(VTMP3.V16B(), VTMP3.V16B(), VTMP3.V16B());
+
+  switch (Op->Function) {
+    case 0: sha1c(VTMP1.Q(), VTMP3.S(), VTMP2.V4S()); break;
+    case 2: sha1m(VTMP1.Q(), VTMP3.S(), VTMP2.V4S()); break;
+    default: sha1p(VTMP1.Q(), VTMP3.S(), VTMP2.V4S()); break;
+  }
+
+  ReverseElements32(GetDst(Node), VTMP1);
+}
+
+DEF_OP(SHA1NextE) {
+  auto Op = IROp->C<IR::IROp_VSha1NextE>();
+
+  mov(VTMP1.S(), GetSrc(Op->Header.Args[0].ID()).V4S(), 3);
+  sha1h(VTMP1.S(), VTMP1.S());
+  // Move the rotated E in to the top element, the rest are zero
+  ext(VTMP1.V16B(), VTMP1.V16B(), VTMP1.V16B(), 4);
+  add(GetDst(Node).V4S(), GetSrc(Op->Header.Args[1].ID()).V4S(), VTMP1.V4S());
+}
+
+DEF_OP(SHA1Msg1) {
+  auto Op = IROp->C<IR::IROp_VSha1Msg1>();
+
+  // Dest = Src1 ^ (Src1[63:0] : Src2[127:64])
+  ext(VTMP1.V16B(), GetSrc(Op->Header.Args[1].ID()).V16B(), GetSrc(Op->Header.Args[0].ID()).V16B(), 8);
+  eor(GetDst(Node).V16B(), GetSrc(Op->Header.Args[0].ID()).V16B(), VTMP1.V16B());
+}
+
+DEF_OP(SHA1Msg2) {
+  auto Op = IROp->C<IR::IROp_VSha1Msg2>();
+
+  ReverseElements32(VTMP1, GetSrc(Op->Header.Args[0].ID()));
+  ReverseElements32(VTMP2, GetSrc(Op->Header.Args[1].ID()));
+  sha1su1(VTMP1.V4S(), VTMP2.V4S());
+  ReverseElements32(GetDst(Node), VTMP1);
+}
+
+DEF_OP(SHA256Rnds2) {
+  auto Op = IROp->C<IR::IROp_VSha256Rnds2>();
+  auto WK = GetSrc(Op->Header.Args[2].ID());
+
+  // Rearrange the x86 {CDGH, ABEF} state pair in to Arm's {ABCD, EFGH}
+  rev64(VTMP1.V4S(), GetSrc(Op->Header.Args[1].ID()).V4S());
+  rev64(VTMP2.V4S(), GetSrc(Op->Header.Args[0].ID()).V4S());
+  zip2(VTMP3.V2D(), VTMP1.V2D(), VTMP2.V2D());
+  zip1(VTMP2.V2D(), VTMP1.V2D(), VTMP2.V2D());
+  mov(VTMP1.V16B(), VTMP3.V16B());
+
+  // Arm always does four rounds. The inputs for the last two rounds are garbage,
+  // but after four rounds C, D, G and H hold A, B, E and F from after the second round.
+  sha256h(VTMP1.Q(), VTMP2.Q(), WK.V4S());
+  sha256h2(VTMP2.Q(), VTMP3.Q(), WK.V4S());
+
+  zip2(VTMP1.V2D(), VTMP2.V2D(), VTMP1.V2D());
+  rev64(GetDst(Node).V4S(), VTMP1.V4S());
+}
+
+DEF_OP(SHA256Msg1) {
+  auto Op = IROp->C<IR::IROp_VSha256Msg1>();
+
+  mov(VTMP1.V16B(), GetSrc(Op->Header.Args[0].ID()).V16B());
+  sha256su0(VTMP1.V4S(), GetSrc(Op->Header.Args[1].ID()).V4S());
+  mov(GetDst(Node).V16B(), VTMP1.V16B());
+}
+
+DEF_OP(SHA256Msg2) {
+  auto Op = IROp->C<IR::IROp_VSha256Msg2>();
+
+  // Arm also adds in W[i-7], which x86 leaves to a separate add. Zero those inputs out.
+  mov(VTMP1.V16B(), GetSrc(Op->Header.Args[0].ID()).V16B());
+  eor(VTMP2.V16B(), VTMP2.V16B(), VTMP2.V16B());
+  mov(VTMP3.V16B(), GetSrc(Op->Header.Args[1].ID()).V16B());
+  ins(VTMP3.V4S(), 0, wzr);
+  sha256su1(VTMP1.V4S(), VTMP2.V4S(), VTMP3.V4S());
+  mov(GetDst(Node).V16B(), VTMP1.V16B());
+}
+
 #undef DEF_OP
 void Arm64JITCore::RegisterEncryptionHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &Arm64JITCore::Op_##x
@@ -97,6 +222,14 @@ void Arm64JITCore::RegisterEncryptionHandlers() {
   REGISTER_OP(VAESDEC,     AESDec);
   REGISTER_OP(VAESDECLAST, AESDecLast);
   REGISTER_OP(VAESKEYGENASSIST, AESKeyGenAssist);
+  REGISTER_OP(VPCLMULQDQ,   PCLMULQDQ);
+  REGISTER_OP(VSHA1RNDS4,   SHA1Rnds4);
+  REGISTER_OP(VSHA1NEXTE,   SHA1NextE);
+  REGISTER_OP(VSHA1MSG1,    SHA1Msg1);
+  REGISTER_OP(VSHA1MSG2,    SHA1Msg2);
+  REGISTER_OP(VSHA256RNDS2, SHA256Rnds2);
+  REGISTER_OP(VSHA256MSG1,  SHA256Msg1);
+  REGISTER_OP(VSHA256MSG2,  SHA256Msg2);
 
 #undef REGISTER_OP
 }
@@ -391,6 +391,31 @@ bool Arm64JITCore::HandleSIGBUS(int Signal, void *info, void *ucontext) {
       ArchHelpers::Context::SetPc(ucontext, ArchHelpers::Context::GetPc(ucontext) - 4);
     }
   }
+  else if ((Instr & 0x3F'E0'0C'00) == 0x19'40'00'00) { // LDAPUR*
+    // Only emitted outside of paranoid mode, keep the signed 9bit offset in the LDUR
+    uint32_t LDUR = 0b0011'1000'0100'0000'0000'0000'0000'0000;
+    LDUR |= Size << 30;
+    LDUR |= Instr & 0x1F'F0'00;
+    LDUR |= AddrReg << 5;
+    LDUR |= DataReg;
+    PC[-1] = DMB;
+    PC[0] = LDUR;
+    PC[1] = DMB;
+    // Back up one instruction and have another go
+    ArchHelpers::Context::SetPc(ucontext, ArchHelpers::Context::GetPc(ucontext) - 4);
+  }
+  else if ((Instr & 0x3F'E0'0C'00) == 0x19'00'00'00) { // STLUR*
+    uint32_t STUR = 0b0011'1000'0000'0000'0000'0000'0000'0000;
+    STUR |= Size << 30;
+    STUR |= Instr & 0x1F'F0'00;
+    STUR |= AddrReg << 5;
+    STUR |= DataReg;
+    PC[-1] = DMB;
+    PC[0] = STUR;
+    PC[1] = DMB;
+    // Back up one instruction and have another go
+    ArchHelpers::Context::SetPc(ucontext, ArchHelpers::Context::GetPc(ucontext) - 4);
+  }
   else if ((Instr & FEXCore::ArchHelpers::Arm64::LDAXP_MASK) == FEXCore::ArchHelpers::Arm64::LDAXP_INST) { // LDAXP
     uint32_t DataReg2 = (Instr >> 10) & 0x1F;
     // Convert to LDP
@@ -475,7 +500,7 @@ bool Arm64JITCore::HandleSIGBUS(int Signal, void *info, void *ucontext) {
 }
 
 Arm64JITCore::Arm64JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread, bool CompileThread)
-  : Arm64Emitter(0)
+  : Arm64Emitter(ctx, 0)
   , CTX {ctx}
   , ThreadState {Thread} {
   {
@@ -741,6 +766,29 @@ bool Arm64JITCore::IsGPR(uint32_t Node) const {
   return Class == IR::GPRClass || Class == IR::GPRFixedClass;
 }
 
+void Arm64JITCore::EmitBlockExitSample() {
+  LoadConstant(TMP1, reinterpret_cast<uintptr_t>(SamplingData));
+
+  // Calculate time spent in block
+  mrs(TMP2, CNTVCT_EL0);
+  ldr(TMP3, MemOperand(TMP1, offsetof(BlockSamplingData::BlockData, Start)));
+  sub(TMP2, TMP2, TMP3);
+
+  // Add time to total time and increment call count
+  ldp(TMP3, TMP4, MemOperand(TMP1, offsetof(BlockSamplingData::BlockData, TotalTime)));
+  add(TMP3, TMP3, TMP2);
+  add(TMP4, TMP4, 1);
+  stp(TMP3, TMP4, MemOperand(TMP1, offsetof(BlockSamplingData::BlockData, TotalTime)));
+
+  // Calculate min and max
+  ldp(TMP3, TMP4, MemOperand(TMP1, offsetof(BlockSamplingData::BlockData, Min)));
+  cmp(TMP3, TMP2);
+  csel(TMP3, TMP2, TMP3, Condition::hi);
+  cmp(TMP4, TMP2);
+  csel(TMP4, TMP2, TMP4, Condition::lo);
+  stp(TMP3, TMP4, MemOperand(TMP1, offsetof(BlockSamplingData::BlockData, Min)));
+}
+
 void *Arm64JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRListView const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData, FEXCore::IR::RegisterAllocationData *RAData) {
   using namespace aarch64;
   JumpTargets.clear();
@@ -821,6 +869,14 @@ void *Arm64JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IR
     }
   }
 
+  SamplingData = CTX->BlockData ? CTX->BlockData->GetBlockData(Entry) : nullptr;
+  if (SamplingData) {
+    // Same counter as RDTSC, readable from userspace without any setup
+    LoadConstant(TMP1, reinterpret_cast<uintptr_t>(SamplingData));
+    mrs(TMP2, CNTVCT_EL0);
+    str(TMP2, MemOperand(TMP1, offsetof(BlockSamplingData::BlockData, Start)));
+  }
+
   PendingTargetLabel = nullptr;
 
   for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
@@ -832,6 +888,7 @@ void *Arm64JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IR
 
     {
       uint32_t Node = IR->GetID(BlockNode);
+      NextBlockID = BlockNode->Header.Next.ID();
       auto IsTarget = JumpTargets.find(Node);
       if (IsTarget == JumpTargets.end()) {
         IsTarget = JumpTargets.try_emplace(Node).first;
@@ -7,6 +7,7 @@ $end_info$
 #pragma once
 
 #include "Interface/Core/ArchHelpers/Arm64Emitter.h"
+#include "Interface/Core/BlockSamplingData.h"
 #include "Interface/Core/Dispatcher/Dispatcher.h"
 
 #include "aarch64/assembler-aarch64.h"
@@ -71,7 +72,13 @@ private:
   FEXCore::IR::IRListView const *IR;
   uint64_t Entry;
 
+  // Per-block counters when block stats are enabled
+  BlockSamplingData::BlockData *SamplingData{};
+  void EmitBlockExitSample();
+
   std::map<IR::OrderedNodeWrapper::NodeOffsetType, aarch64::Label> JumpTargets;
+  // The block that will be emitted after the current one, which can be reached by falling through
+  IR::OrderedNodeWrapper::NodeOffsetType NextBlockID{};
 
   /**
    * @name Register Allocation
@@ -121,10 +128,14 @@ private:
   bool IsGPR(uint32_t Node) const;
 
   MemOperand GenerateMemOperand(uint8_t AccessSize, aarch64::Register Base, IR::OrderedNodeWrapper Offset, IR::MemOffsetType OffsetType, uint8_t OffsetScale);
+  // Calculates the address in to TMP4 when AllowImm is false or the offset doesn't fit the unscaled immediate
+  MemOperand GenerateTSOMemOperand(aarch64::Register Base, IR::OrderedNodeWrapper Offset, bool AllowImm);
 
   bool IsInlineConstant(const IR::OrderedNodeWrapper& Node, uint64_t* Value = nullptr) const;
   bool IsInlineEntrypointOffset(const IR::OrderedNodeWrapper& WNode, uint64_t* Value) const;
 
+  void ReverseElements32(aarch64::VRegister const &Dst, aarch64::VRegister const &Src);
+
   struct LiveRange {
     uint32_t Begin;
     uint32_t End;
@@ -200,6 +211,7 @@ private:
   DEF_OP(InlineConstant);
   DEF_OP(InlineEntrypointOffset);
   DEF_OP(CycleCounter);
+  DEF_OP(RDRAND);
   DEF_OP(Add);
   DEF_OP(Sub);
   DEF_OP(Neg);
@@ -227,6 +239,7 @@ private:
   DEF_OP(Zext);
   DEF_OP(Not);
   DEF_OP(Popcount);
+  DEF_OP(CRC32);
   DEF_OP(FindLSB);
   DEF_OP(FindMSB);
   DEF_OP(FindTrailingZeros);
@@ -271,6 +284,7 @@ private:
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(RemoveCodeEntry);
+  DEF_OP(DebugBreakpoint);
   DEF_OP(CPUID);
 
   ///< Conversion ops
@@ -306,11 +320,18 @@ private:
   DEF_OP(ParanoidStoreMemTSO);
   DEF_OP(VLoadMemElement);
   DEF_OP(VStoreMemElement);
+  DEF_OP(StringScan16);
+  DEF_OP(StringCompare16);
   DEF_OP(CacheLineClear);
+  DEF_OP(CacheLineClean);
+  DEF_OP(Prefetch);
+  DEF_OP(StoreMemNonTemporal);
 
   ///< Misc ops
   DEF_OP(EndBlock);
   DEF_OP(Fence);
+  DEF_OP(Yield);
+  DEF_OP(SpinWait);
   DEF_OP(Break);
   DEF_OP(Phi);
   DEF_OP(PhiValue);
@@ -326,8 +347,6 @@ private:
   ///< Vector ops
   DEF_OP(VectorZero);
   DEF_OP(VectorImm);
-  DEF_OP(CreateVector2);
-  DEF_OP(CreateVector4);
   DEF_OP(SplatVector2);
   DEF_OP(SplatVector4);
   DEF_OP(VMov);
@@ -368,6 +387,9 @@ private:
   DEF_OP(VZip2);
   DEF_OP(VUnZip);
   DEF_OP(VUnZip2);
+  DEF_OP(VTrn);
+  DEF_OP(VTrn2);
+  DEF_OP(VRev64);
   DEF_OP(VBSL);
   DEF_OP(VCMPEQ);
   DEF_OP(VCMPEQZ);
@@ -423,6 +445,14 @@ private:
   DEF_OP(AESDec);
   DEF_OP(AESDecLast);
   DEF_OP(AESKeyGenAssist);
+  DEF_OP(PCLMULQDQ);
+  DEF_OP(SHA1Rnds4);
+  DEF_OP(SHA1NextE);
+  DEF_OP(SHA1Msg1);
+  DEF_OP(SHA1Msg2);
+  DEF_OP(SHA256Rnds2);
+  DEF_OP(SHA256Msg1);
+  DEF_OP(SHA256Msg2);
 #undef DEF_OP
 };
 
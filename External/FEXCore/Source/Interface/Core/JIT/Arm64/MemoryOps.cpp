@@ -567,6 +567,27 @@ MemOperand Arm64JITCore::GenerateMemOperand(uint8_t AccessSize, aarch64::Registe
   FEX_UNREACHABLE;
 }
 
+MemOperand Arm64JITCore::GenerateTSOMemOperand(aarch64::Register Base, IR::OrderedNodeWrapper Offset, bool AllowImm) {
+  if (Offset.IsInvalid()) {
+    return MemOperand(Base);
+  }
+
+  uint64_t Const;
+  if (IsInlineConstant(Offset, &Const)) {
+    if (AllowImm && IsImmLSUnscaled(static_cast<int64_t>(Const))) {
+      return MemOperand(Base, Const);
+    }
+
+    LoadConstant(TMP4, Const);
+    add(TMP4, Base, TMP4);
+  }
+  else {
+    add(TMP4, Base, GetReg<RA_64>(Offset.ID()));
+  }
+
+  return MemOperand(TMP4);
+}
+
 DEF_OP(LoadMem) {
   auto Op = IROp->C<IR::IROp_LoadMem>();
 
@@ -617,13 +638,36 @@ DEF_OP(LoadMem) {
 DEF_OP(LoadMemTSO) {
   auto Op = IROp->C<IR::IROp_LoadMemTSO>();
 
-  auto MemSrc = MemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()));
+  // ldapur and the vector ldr take the immediate offset, ldar and ldapr only take a base register
+  bool AllowImm = SupportsRCPCImm || Op->Class != FEXCore::IR::GPRClass;
+  auto MemSrc = GenerateTSOMemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()), Op->Offset, AllowImm);
 
-  if (!Op->Offset.IsInvalid()) {
-    LOGMAN_MSG_A_FMT("LoadMemTSO: No offset allowed");
+  if (SupportsRCPCImm && Op->Class == FEXCore::IR::GPRClass) {
+    if (Op->Size == 1) {
+      // 8bit load is always aligned to natural alignment
+      auto Dst = GetReg<RA_64>(Node);
+      ldapurb(Dst.W(), MemSrc);
+    }
+    else {
+      // Aligned
+      auto Dst = GetReg<RA_64>(Node);
+      nop();
+      switch (Op->Size) {
+        case 2:
+          ldapurh(Dst.W(), MemSrc);
+          break;
+        case 4:
+          ldapur(Dst.W(), MemSrc);
+          break;
+        case 8:
+          ldapur(Dst, MemSrc);
+          break;
+        default:  LOGMAN_MSG_A_FMT("Unhandled LoadMemTSO size: {}", Op->Size);
+      }
+      nop();
+    }
   }
-
-  if (SupportsRCPC && Op->Class == FEXCore::IR::GPRClass) {
+  else if (SupportsRCPC && Op->Class == FEXCore::IR::GPRClass) {
     if (Op->Size == 1) {
       // 8bit load is always aligned to natural alignment
       auto Dst = GetReg<RA_64>(Node);
@@ -744,13 +788,34 @@ DEF_OP(StoreMem) {
 
 DEF_OP(StoreMemTSO) {
   auto Op = IROp->C<IR::IROp_StoreMemTSO>();
-  auto MemSrc = MemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()));
 
-  if (!Op->Offset.IsInvalid()) {
-    LOGMAN_MSG_A_FMT("StoreMemTSO: No offset allowed");
-  }
+  // stlur and the vector str take the immediate offset, stlr only takes a base register
+  bool AllowImm = SupportsRCPCImm || Op->Class != FEXCore::IR::GPRClass;
+  auto MemSrc = GenerateTSOMemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()), Op->Offset, AllowImm);
 
-  if (Op->Class == FEXCore::IR::GPRClass) {
+  if (SupportsRCPCImm && Op->Class == FEXCore::IR::GPRClass) {
+    if (Op->Size == 1) {
+      // 8bit store is always aligned to natural alignment
+      stlurb(GetReg<RA_32>(Op->Header.Args[1].ID()), MemSrc);
+    }
+    else {
+      nop();
+      switch (Op->Size) {
+        case 2:
+          stlurh(GetReg<RA_32>(Op->Header.Args[1].ID()), MemSrc);
+          break;
+        case 4:
+          stlur(GetReg<RA_32>(Op->Header.Args[1].ID()), MemSrc);
+          break;
+        case 8:
+          stlur(GetReg<RA_64>(Op->Header.Args[1].ID()), MemSrc);
+          break;
+        default:  LOGMAN_MSG_A_FMT("Unhandled StoreMemTSO size: {}", Op->Size);
+      }
+      nop();
+    }
+  }
+  else if (Op->Class == FEXCore::IR::GPRClass) {
     if (Op->Size == 1) {
       // 8bit load is always aligned to natural alignment
       stlrb(GetReg<RA_64>(Op->Header.Args[1].ID()), MemSrc);
@@ -800,11 +865,7 @@ DEF_OP(StoreMemTSO) {
 DEF_OP(ParanoidLoadMemTSO) {
   auto Op = IROp->C<IR::IROp_LoadMemTSO>();
 
-  auto MemSrc = MemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()));
-
-  if (!Op->Offset.IsInvalid()) {
-    LOGMAN_MSG_A_FMT("ParanoidLoadMemTSO: No offset allowed");
-  }
+  auto MemSrc = GenerateTSOMemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()), Op->Offset, false);
 
   if (Op->Class == FEXCore::IR::GPRClass) {
     if (Op->Size == 1) {
@@ -857,11 +918,7 @@ DEF_OP(ParanoidLoadMemTSO) {
 
 DEF_OP(ParanoidStoreMemTSO) {
   auto Op = IROp->C<IR::IROp_StoreMemTSO>();
-  auto MemSrc = MemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()));
-
-  if (!Op->Offset.IsInvalid()) {
-    LOGMAN_MSG_A_FMT("ParanoidStoreMemTSO: No offset allowed");
-  }
+  auto MemSrc = GenerateTSOMemOperand(GetReg<RA_64>(Op->Header.Args[0].ID()), Op->Offset, false);
 
   if (Op->Class == FEXCore::IR::GPRClass) {
     if (Op->Size == 1) {
@@ -933,19 +990,127 @@ DEF_OP(VStoreMemElement) {
   LOGMAN_MSG_A_FMT("Unimplemented");
 }
 
+DEF_OP(StringScan16) {
+  auto Op = IROp->C<IR::IROp_StringScan16>();
+  auto MemReg = GetReg<RA_64>(Op->Header.Args[0].ID());
+
+  ldr(VTMP1.Q(), MemOperand(MemReg));
+  dup(VTMP2.V16B(), GetReg<RA_32>(Op->Header.Args[1].ID()));
+  cmeq(VTMP1.V16B(), VTMP1.V16B(), VTMP2.V16B());
+
+  if (!Op->MatchEqual) {
+    mvn(VTMP1.V16B(), VTMP1.V16B());
+  }
+
+  // Narrow each byte of the mask to a nibble, the first match is then the lowest set nibble
+  shrn(VTMP1.V8B(), VTMP1.V8H(), 4);
+  fmov(TMP1, VTMP1.D());
+  rbit(TMP1, TMP1);
+  clz(TMP1, TMP1);
+  // No match gives 64, which scales down to 16
+  lsr(GetReg<RA_64>(Node), TMP1, 2);
+}
+
+DEF_OP(StringCompare16) {
+  auto Op = IROp->C<IR::IROp_StringCompare16>();
+
+  ldr(VTMP1.Q(), MemOperand(GetReg<RA_64>(Op->Header.Args[0].ID())));
+  ldr(VTMP2.Q(), MemOperand(GetReg<RA_64>(Op->Header.Args[1].ID())));
+  cmeq(VTMP1.V16B(), VTMP1.V16B(), VTMP2.V16B());
+
+  if (!Op->MatchEqual) {
+    mvn(VTMP1.V16B(), VTMP1.V16B());
+  }
+
+  // Narrow each byte of the mask to a nibble, the first match is then the lowest set nibble
+  shrn(VTMP1.V8B(), VTMP1.V8H(), 4);
+  fmov(TMP1, VTMP1.D());
+  rbit(TMP1, TMP1);
+  clz(TMP1, TMP1);
+  // No match gives 64, which scales down to 16
+  lsr(GetReg<RA_64>(Node), TMP1, 2);
+}
+
 DEF_OP(CacheLineClear) {
   auto Op = IROp->C<IR::IROp_CacheLineClear>();
 
   auto MemReg = GetReg<RA_64>(Op->Header.Args[0].ID());
 
-  // Clear dcache only
+  // Clean and invalidate the whole 64 byte x86 line to the point of coherency, the host lines may be smaller
   // icache doesn't matter here since the guest application shouldn't be calling clflush on JIT code.
-  mov(TMP1, MemReg);
-  for (size_t i = 0; i < std::max(1U, DCacheLineSize / 64U); ++i) {
-    dc(DataCacheOp::CVAU, TMP1);
+  and_(TMP1, MemReg, ~63ULL);
+  for (size_t i = 0; i < std::max(1U, 64U / DCacheLineSize); ++i) {
+    dc(DataCacheOp::CIVAC, TMP1);
+    add(TMP1, TMP1, DCacheLineSize);
+  }
+
+  // Only CLFLUSH is ordered against other stores, CLFLUSHOPT is left to a later fence
+  if (Op->Serialize) {
+    dsb(InnerShareable, BarrierAll);
+  }
+}
+
+DEF_OP(CacheLineClean) {
+  auto Op = IROp->C<IR::IROp_CacheLineClean>();
+
+  auto MemReg = GetReg<RA_64>(Op->Header.Args[0].ID());
+
+  // Write back without invalidating, ordering is left to a later fence
+  and_(TMP1, MemReg, ~63ULL);
+  for (size_t i = 0; i < std::max(1U, 64U / DCacheLineSize); ++i) {
+    dc(DataCacheOp::CVAC, TMP1);
     add(TMP1, TMP1, DCacheLineSize);
   }
-  dsb(InnerShareable, BarrierAll);
+}
+
+DEF_OP(Prefetch) {
+  auto Op = IROp->C<IR::IROp_Prefetch>();
+
+  auto MemReg = GetReg<RA_64>(Op->Header.Args[0].ID());
+
+  // PRFM encodes {Type:2, Target:2, Policy:1}, PLD is 0 and PST is 2. Levels start at L1 as 0.
+  const auto PrefetchOp = static_cast<PrefetchOperation>(
+    (Op->ForStore ? 0b10'000 : 0) |
+    ((Op->CacheLevel - 1) << 1) |
+    (Op->Stream ? 1 : 0));
+  prfm(PrefetchOp, MemOperand(MemReg));
+}
+
+DEF_OP(StoreMemNonTemporal) {
+  auto Op = IROp->C<IR::IROp_StoreMemNonTemporal>();
+
+  auto MemReg = GetReg<RA_64>(Op->Header.Args[0].ID());
+  auto MemSrc = MemOperand(MemReg);
+
+  if (Op->Class == FEXCore::IR::GPRClass) {
+    // There is no single register STNP, a plain store keeps the same x86 visible semantics
+    switch (Op->Size) {
+      case 4:
+        str(GetReg<RA_32>(Op->Header.Args[1].ID()), MemSrc);
+        break;
+      case 8:
+        str(GetReg<RA_64>(Op->Header.Args[1].ID()), MemSrc);
+        break;
+      default:  LOGMAN_MSG_A_FMT("Unhandled StoreMemNonTemporal size: {}", Op->Size);
+    }
+  }
+  else {
+    auto Src = GetSrc(Op->Header.Args[1].ID());
+    switch (Op->Size) {
+      case 4:
+        str(Src.S(), MemSrc);
+        break;
+      case 8:
+        str(Src.D(), MemSrc);
+        break;
+      case 16:
+        // Split the vector in to a pair so it can use the non-temporal hint
+        dup(VTMP1.V2D(), Src.V2D(), 1);
+        stnp(Src.D(), VTMP1.D(), MemSrc);
+        break;
+      default:  LOGMAN_MSG_A_FMT("Unhandled StoreMemNonTemporal size: {}", Op->Size);
+    }
+  }
 }
 
 #undef DEF_OP
@@ -973,7 +1138,12 @@ void Arm64JITCore::RegisterMemoryHandlers() {
   }
   REGISTER_OP(VLOADMEMELEMENT,     VLoadMemElement);
   REGISTER_OP(VSTOREMEMELEMENT,    VStoreMemElement);
+  REGISTER_OP(STRINGSCAN16,        StringScan16);
+  REGISTER_OP(STRINGCOMPARE16,     StringCompare16);
   REGISTER_OP(CACHELINECLEAR,      CacheLineClear);
+  REGISTER_OP(CACHELINECLEAN,      CacheLineClean);
+  REGISTER_OP(PREFETCH,            Prefetch);
+  REGISTER_OP(STOREMEMNONTEMPORAL, StoreMemNonTemporal);
 #undef REGISTER_OP
 }
 }
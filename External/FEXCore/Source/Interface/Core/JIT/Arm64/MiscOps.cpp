@@ -35,6 +35,52 @@ DEF_OP(Fence) {
   }
 }
 
+DEF_OP(Yield) {
+  // Let other hardware threads run while the guest spins
+  hint(YIELD);
+}
+
+DEF_OP(SpinWait) {
+  auto Op = IROp->C<IR::IROp_SpinWait>();
+  auto MemSrc = GetReg<RA_64>(Op->Header.Args[0].ID());
+  auto Expected = GetReg<RA_64>(Op->Header.Args[1].ID());
+
+  aarch64::Label Changed;
+
+  // Exclusive loads fault on unaligned addresses, just return to the guest loop then
+  if (Op->Size > 1) {
+    tst(MemSrc, Op->Size - 1);
+    b(&Changed, Condition::ne);
+  }
+
+  switch (Op->Size) {
+    case 1:
+      ldaxrb(TMP1.W(), MemOperand(MemSrc));
+      cmp(TMP1.W(), Expected.W());
+      break;
+    case 2:
+      ldaxrh(TMP1.W(), MemOperand(MemSrc));
+      cmp(TMP1.W(), Expected.W());
+      break;
+    case 4:
+      ldaxr(TMP1.W(), MemOperand(MemSrc));
+      cmp(TMP1.W(), Expected.W());
+      break;
+    case 8:
+      ldaxr(TMP1.X(), MemOperand(MemSrc));
+      cmp(TMP1.X(), Expected.X());
+      break;
+    default: LOGMAN_MSG_A_FMT("Unhandled SpinWait size: {}", Op->Size); break;
+  }
+  b(&Changed, Condition::ne);
+
+  // The exclusive monitor is now armed on the location, a store from another core wakes us up.
+  // If that store never comes then the kernel's event stream or the next interrupt bounds the wait.
+  hint(WFE);
+
+  bind(&Changed);
+}
+
 DEF_OP(Break) {
   auto Op = IROp->C<IR::IROp_Break>();
   switch (Op->Reason) {
@@ -162,6 +208,8 @@ void Arm64JITCore::RegisterMiscHandlers() {
   REGISTER_OP(BEGINBLOCK, NoOp);
   REGISTER_OP(ENDBLOCK,   NoOp);
   REGISTER_OP(FENCE,      Fence);
+  REGISTER_OP(YIELD,      Yield);
+  REGISTER_OP(SPINWAIT,   SpinWait);
   REGISTER_OP(BREAK,      Break);
   REGISTER_OP(PHI,        NoOp);
   REGISTER_OP(PHIVALUE,   NoOp);
@@ -42,14 +42,6 @@ DEF_OP(VectorImm) {
   }
 }
 
-DEF_OP(CreateVector2) {
-  LOGMAN_MSG_A_FMT("Unimplemented");
-}
-
-DEF_OP(CreateVector4) {
-  LOGMAN_MSG_A_FMT("Unimplemented");
-}
-
 DEF_OP(SplatVector2) {
   auto Op = IROp->C<IR::IROp_SplatVector2>();
   uint8_t OpSize = IROp->Size;
@@ -1077,6 +1069,82 @@ DEF_OP(VUnZip2) {
   }
 }
 
+DEF_OP(VTrn) {
+  auto Op = IROp->C<IR::IROp_VTrn>();
+  uint8_t OpSize = IROp->Size;
+  auto Dst = GetDst(Node);
+  auto Lower = GetSrc(Op->Header.Args[0].ID());
+  auto Upper = GetSrc(Op->Header.Args[1].ID());
+
+  if (OpSize == 8) {
+    switch (Op->Header.ElementSize) {
+    case 1: trn1(Dst.V8B(), Lower.V8B(), Upper.V8B()); break;
+    case 2: trn1(Dst.V4H(), Lower.V4H(), Upper.V4H()); break;
+    case 4: trn1(Dst.V2S(), Lower.V2S(), Upper.V2S()); break;
+    default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", Op->Header.ElementSize); break;
+    }
+  }
+  else {
+    switch (Op->Header.ElementSize) {
+    case 1: trn1(Dst.V16B(), Lower.V16B(), Upper.V16B()); break;
+    case 2: trn1(Dst.V8H(), Lower.V8H(), Upper.V8H()); break;
+    case 4: trn1(Dst.V4S(), Lower.V4S(), Upper.V4S()); break;
+    case 8: trn1(Dst.V2D(), Lower.V2D(), Upper.V2D()); break;
+    default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", Op->Header.ElementSize); break;
+    }
+  }
+}
+
+DEF_OP(VTrn2) {
+  auto Op = IROp->C<IR::IROp_VTrn2>();
+  uint8_t OpSize = IROp->Size;
+  auto Dst = GetDst(Node);
+  auto Lower = GetSrc(Op->Header.Args[0].ID());
+  auto Upper = GetSrc(Op->Header.Args[1].ID());
+
+  if (OpSize == 8) {
+    switch (Op->Header.ElementSize) {
+    case 1: trn2(Dst.V8B(), Lower.V8B(), Upper.V8B()); break;
+    case 2: trn2(Dst.V4H(), Lower.V4H(), Upper.V4H()); break;
+    case 4: trn2(Dst.V2S(), Lower.V2S(), Upper.V2S()); break;
+    default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", Op->Header.ElementSize); break;
+    }
+  }
+  else {
+    switch (Op->Header.ElementSize) {
+    case 1: trn2(Dst.V16B(), Lower.V16B(), Upper.V16B()); break;
+    case 2: trn2(Dst.V8H(), Lower.V8H(), Upper.V8H()); break;
+    case 4: trn2(Dst.V4S(), Lower.V4S(), Upper.V4S()); break;
+    case 8: trn2(Dst.V2D(), Lower.V2D(), Upper.V2D()); break;
+    default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", Op->Header.ElementSize); break;
+    }
+  }
+}
+
+DEF_OP(VRev64) {
+  auto Op = IROp->C<IR::IROp_VRev64>();
+  uint8_t OpSize = IROp->Size;
+  auto Dst = GetDst(Node);
+  auto Src = GetSrc(Op->Header.Args[0].ID());
+
+  if (OpSize == 8) {
+    switch (Op->Header.ElementSize) {
+    case 1: rev64(Dst.V8B(), Src.V8B()); break;
+    case 2: rev64(Dst.V4H(), Src.V4H()); break;
+    case 4: rev64(Dst.V2S(), Src.V2S()); break;
+    default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", Op->Header.ElementSize); break;
+    }
+  }
+  else {
+    switch (Op->Header.ElementSize) {
+    case 1: rev64(Dst.V16B(), Src.V16B()); break;
+    case 2: rev64(Dst.V8H(), Src.V8H()); break;
+    case 4: rev64(Dst.V4S(), Src.V4S()); break;
+    default: LOGMAN_MSG_A_FMT("Unknown Element Size: {}", Op->Header.ElementSize); break;
+    }
+  }
+}
+
 DEF_OP(VBSL) {
   auto Op = IROp->C<IR::IROp_VBSL>();
   if (IROp->Size == 16) {
@@ -2323,8 +2391,6 @@ void Arm64JITCore::RegisterVectorHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &Arm64JITCore::Op_##x
   REGISTER_OP(VECTORZERO,        VectorZero);
   REGISTER_OP(VECTORIMM,         VectorImm);
-  REGISTER_OP(CREATEVECTOR2,     CreateVector2);
-  REGISTER_OP(CREATEVECTOR4,     CreateVector4);
   REGISTER_OP(SPLATVECTOR2,      SplatVector2);
   REGISTER_OP(SPLATVECTOR4,      SplatVector4);
   REGISTER_OP(VMOV,              VMov);
@@ -2365,6 +2431,9 @@ void Arm64JITCore::RegisterVectorHandlers() {
   REGISTER_OP(VZIP2,             VZip2);
   REGISTER_OP(VUNZIP,            VUnZip);
   REGISTER_OP(VUNZIP2,           VUnZip2);
+  REGISTER_OP(VTRN,              VTrn);
+  REGISTER_OP(VTRN2,             VTrn2);
+  REGISTER_OP(VREV64,            VRev64);
   REGISTER_OP(VBSL,              VBSL);
   REGISTER_OP(VCMPEQ,            VCMPEQ);
   REGISTER_OP(VCMPEQZ,           VCMPEQZ);
@@ -55,6 +55,19 @@ DEF_OP(CycleCounter) {
 #endif
 }
 
+DEF_OP(RDRAND) {
+  auto Dst = GetSrcPair<RA_64>(Node);
+  if (CTX->HostFeatures.SupportsRAND) {
+    rdrand(Dst.first);
+    setc(Dst.second.cvt8());
+    movzx(Dst.second.cvt32(), Dst.second.cvt8());
+  }
+  else {
+    xor_(Dst.first.cvt32(), Dst.first.cvt32());
+    xor_(Dst.second.cvt32(), Dst.second.cvt32());
+  }
+}
+
 DEF_OP(Add) {
   auto Op = IROp->C<IR::IROp_Add>();
   uint8_t OpSize = IROp->Size;
@@ -801,6 +814,28 @@ DEF_OP(Popcount) {
   }
 }
 
+DEF_OP(CRC32) {
+  auto Op = IROp->C<IR::IROp_CRC32>();
+  auto Dst = GetDst<RA_32>(Node).cvt32();
+  mov(Dst, GetSrc<RA_32>(Op->Crc.ID()));
+  switch (Op->SrcSize) {
+    case 1:
+      crc32(Dst, GetSrc<RA_8>(Op->Src.ID()));
+      break;
+    case 2:
+      crc32(Dst, GetSrc<RA_16>(Op->Src.ID()));
+      break;
+    case 4:
+      crc32(Dst, GetSrc<RA_32>(Op->Src.ID()));
+      break;
+    case 8:
+      // The 64bit form only differs in the source, the checksum is still 32bit
+      crc32(Dst.cvt64(), GetSrc<RA_64>(Op->Src.ID()));
+      break;
+    default: LOGMAN_MSG_A_FMT("Unsupported CRC32 size: {}", Op->SrcSize);
+  }
+}
+
 DEF_OP(FindLSB) {
   auto Op = IROp->C<IR::IROp_FindLSB>();
 
@@ -1201,6 +1236,7 @@ void X86JITCore::RegisterALUHandlers() {
   REGISTER_OP(INLINECONSTANT,    InlineConstant);
   REGISTER_OP(INLINEENTRYPOINTOFFSET,  InlineEntrypointOffset);
   REGISTER_OP(CYCLECOUNTER,      CycleCounter);
+  REGISTER_OP(RDRAND,            RDRAND);
   REGISTER_OP(ADD,               Add);
   REGISTER_OP(SUB,               Sub);
   REGISTER_OP(NEG,               Neg);
@@ -1226,6 +1262,7 @@ void X86JITCore::RegisterALUHandlers() {
   REGISTER_OP(LUREM,             LURem);
   REGISTER_OP(NOT,               Not);
   REGISTER_OP(POPCOUNT,          Popcount);
+  REGISTER_OP(CRC32,             CRC32);
   REGISTER_OP(FINDLSB,           FindLSB);
   REGISTER_OP(FINDMSB,           FindMSB);
   REGISTER_OP(FINDTRAILINGZEROS, FindTrailingZeros);
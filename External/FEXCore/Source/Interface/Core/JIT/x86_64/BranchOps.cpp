@@ -13,6 +13,8 @@ $end_info$
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <Interface/HLE/Thunks/Thunks.h>
 
+#include <xxhash.h>
+
 namespace FEXCore::CPU {
 #define DEF_OP(x) void X86JITCore::Op_##x(FEXCore::IR::IROp_Header *IROp, uint32_t Node)
 DEF_OP(GuestCallDirect) {
@@ -68,6 +70,9 @@ DEF_OP(ExitFunction) {
   Label FullLookup;
   auto Op = IROp->C<IR::IROp_ExitFunction>();
 
+  if (SamplingData) {
+    EmitBlockExitSample();
+  }
 
   if (SpillSlots) {
     add(rsp, SpillSlots * 16);
@@ -107,10 +112,6 @@ DEF_OP(ExitFunction) {
     mov(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, State.rip)], RipReg);
     jmp(rax);
   }
-
-#ifdef BLOCKSTATS
-  ExitBlock();
-#endif
 }
 
 DEF_OP(Jump) {
@@ -250,32 +251,80 @@ DEF_OP(Thunk) {
 
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
-  const auto* OldCode = (const uint8_t*)&Op->CodeOriginalLow;
-  int len = Op->CodeLength;
-  int idx = 0;
-
-  xor_(GetDst<RA_64>(Node), GetDst<RA_64>(Node));
-  mov(rax, Entry + Op->Offset);
-  mov(rbx, 1);
-  while (len >= 4) {
-    cmp(dword[rax + idx], *(const uint32_t*)(OldCode + idx));
-    cmovne(GetDst<RA_64>(Node), rbx);
-    len-=4;
-    idx+=4;
+  auto Dst = GetDst<RA_64>(Node);
+  auto CodePtr = reinterpret_cast<uint8_t const*>(Entry + Op->Offset);
+  uint32_t Length = Op->CodeLength;
+  std::vector<uint8_t> Code(CodePtr, CodePtr + Length);
+
+  if (XXH3_64bits(Code.data(), Length) != Op->CodeHash) {
+    // The code already changed since it was decoded, this can only fail
+    mov(Dst, 1);
+    return;
+  }
+
+  // Compare the guest code against a copy that lives right after this check.
+  // Walk it in the largest chunks that fit, the last chunk overlaps the one before it.
+  uint32_t ChunkSize = Length >= 16 ? 16 : Length >= 8 ? 8 : Length >= 4 ? 4 : Length >= 2 ? 2 : 1;
+  std::vector<uint32_t> Offsets;
+  for (uint32_t Offset = 0; Offset + ChunkSize < Length; Offset += ChunkSize) {
+    Offsets.emplace_back(Offset);
+  }
+  Offsets.emplace_back(Length - ChunkSize);
+
+  Label Copy;
+  Label PastCopy;
+  mov(TMP1, Entry + Op->Offset);
+  lea(TMP2, ptr[rip + Copy]);
+
+  xor_(Dst, Dst);
+  for (size_t i = 0; i < Offsets.size(); ++i) {
+    auto Offset = Offsets[i];
+    switch (ChunkSize) {
+      case 16:
+        if (i == 0) {
+          vmovdqu(xmm15, ptr[TMP1 + Offset]);
+          vpxor(xmm15, xmm15, ptr[TMP2 + Offset]);
+        }
+        else {
+          vmovdqu(xmm14, ptr[TMP1 + Offset]);
+          vpxor(xmm14, xmm14, ptr[TMP2 + Offset]);
+          vpor(xmm15, xmm15, xmm14);
+        }
+        break;
+      case 8:
+        mov(TMP3, qword[TMP1 + Offset]);
+        xor_(TMP3, qword[TMP2 + Offset]);
+        or_(Dst, TMP3);
+        break;
+      case 4:
+        mov(TMP3.cvt32(), dword[TMP1 + Offset]);
+        xor_(TMP3.cvt32(), dword[TMP2 + Offset]);
+        or_(Dst, TMP3);
+        break;
+      case 2:
+        movzx(TMP3.cvt32(), word[TMP1 + Offset]);
+        xor_(TMP3.cvt16(), word[TMP2 + Offset]);
+        or_(Dst, TMP3);
+        break;
+      default:
+        movzx(TMP3.cvt32(), byte[TMP1 + Offset]);
+        xor_(TMP3.cvt8(), byte[TMP2 + Offset]);
+        or_(Dst, TMP3);
+        break;
+    }
   }
-  while (len >= 2) {
-    mov(rcx, *(const uint16_t*)(OldCode + idx));
-    cmp(word[rax + idx], cx);
-    cmovne(GetDst<RA_64>(Node), rbx);
-    len-=2;
-    idx+=2;
+
+  if (ChunkSize == 16) {
+    vptest(xmm15, xmm15);
+    setnz(Dst.cvt8());
   }
-  while (len >= 1) {
-    cmp(byte[rax + idx], *(const uint8_t*)(OldCode + idx));
-    cmovne(GetDst<RA_64>(Node), rbx);
-    len-=1;
-    idx+=1;
+
+  jmp(PastCopy, T_NEAR);
+  L(Copy);
+  for (auto Byte : Code) {
+    db(Byte);
   }
+  L(PastCopy);
 }
 
 DEF_OP(RemoveCodeEntry) {
@@ -302,6 +351,27 @@ DEF_OP(RemoveCodeEntry) {
     pop(RA64[i - 1]);
 }
 
+DEF_OP(DebugBreakpoint) {
+  auto NumPush = RA64.size();
+
+  for (auto &Reg : RA64)
+    push(Reg);
+
+  if (NumPush & 1)
+    sub(rsp, 8); // Align
+
+  mov(rdi, STATE);
+
+  mov(rax, reinterpret_cast<uintptr_t>(&Context::Context::HandleDebugBreakpoint));
+  call(rax);
+
+  if (NumPush & 1)
+    add(rsp, 8); // Align
+
+  for (uint32_t i = RA64.size(); i > 0; --i)
+    pop(RA64[i - 1]);
+}
+
 DEF_OP(CPUID) {
   auto Op = IROp->C<IR::IROp_CPUID>();
 
@@ -363,6 +433,7 @@ void X86JITCore::RegisterBranchHandlers() {
   REGISTER_OP(THUNK,             Thunk);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(REMOVECODEENTRY,   RemoveCodeEntry);
+  REGISTER_OP(DEBUGBREAKPOINT,   DebugBreakpoint);
   REGISTER_OP(CPUID,             CPUID);
 #undef REGISTER_OP
 }
@@ -40,6 +40,63 @@ DEF_OP(AESKeyGenAssist) {
   vaeskeygenassist(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->RCON);
 }
 
+DEF_OP(PCLMULQDQ) {
+  auto Op = IROp->C<IR::IROp_VPCLMULQDQ>();
+  vpclmulqdq(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[1].ID()), Op->Selector);
+}
+
+// The SHA instructions only have destructive encodings
+DEF_OP(SHA1Rnds4) {
+  auto Op = IROp->C<IR::IROp_VSha1Rnds4>();
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha1rnds4(xmm15, GetSrc(Op->Header.Args[1].ID()), Op->Function);
+  movapd(GetDst(Node), xmm15);
+}
+
+DEF_OP(SHA1NextE) {
+  auto Op = IROp->C<IR::IROp_VSha1NextE>();
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha1nexte(xmm15, GetSrc(Op->Header.Args[1].ID()));
+  movapd(GetDst(Node), xmm15);
+}
+
+DEF_OP(SHA1Msg1) {
+  auto Op = IROp->C<IR::IROp_VSha1Msg1>();
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha1msg1(xmm15, GetSrc(Op->Header.Args[1].ID()));
+  movapd(GetDst(Node), xmm15);
+}
+
+DEF_OP(SHA1Msg2) {
+  auto Op = IROp->C<IR::IROp_VSha1Msg2>();
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha1msg2(xmm15, GetSrc(Op->Header.Args[1].ID()));
+  movapd(GetDst(Node), xmm15);
+}
+
+DEF_OP(SHA256Rnds2) {
+  auto Op = IROp->C<IR::IROp_VSha256Rnds2>();
+  // WK is implicitly xmm0, which RA never hands out
+  movapd(xmm0, GetSrc(Op->Header.Args[2].ID()));
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha256rnds2(xmm15, GetSrc(Op->Header.Args[1].ID()));
+  movapd(GetDst(Node), xmm15);
+}
+
+DEF_OP(SHA256Msg1) {
+  auto Op = IROp->C<IR::IROp_VSha256Msg1>();
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha256msg1(xmm15, GetSrc(Op->Header.Args[1].ID()));
+  movapd(GetDst(Node), xmm15);
+}
+
+DEF_OP(SHA256Msg2) {
+  auto Op = IROp->C<IR::IROp_VSha256Msg2>();
+  movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
+  sha256msg2(xmm15, GetSrc(Op->Header.Args[1].ID()));
+  movapd(GetDst(Node), xmm15);
+}
+
 #undef DEF_OP
 void X86JITCore::RegisterEncryptionHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &X86JITCore::Op_##x
@@ -49,6 +106,14 @@ void X86JITCore::RegisterEncryptionHandlers() {
   REGISTER_OP(VAESDEC,     AESDec);
   REGISTER_OP(VAESDECLAST, AESDecLast);
   REGISTER_OP(VAESKEYGENASSIST, AESKeyGenAssist);
+  REGISTER_OP(VPCLMULQDQ,   PCLMULQDQ);
+  REGISTER_OP(VSHA1RNDS4,   SHA1Rnds4);
+  REGISTER_OP(VSHA1NEXTE,   SHA1NextE);
+  REGISTER_OP(VSHA1MSG1,    SHA1Msg1);
+  REGISTER_OP(VSHA1MSG2,    SHA1Msg2);
+  REGISTER_OP(VSHA256RNDS2, SHA256Rnds2);
+  REGISTER_OP(VSHA256MSG1,  SHA256Msg1);
+  REGISTER_OP(VSHA256MSG2,  SHA256Msg2);
 
 #undef REGISTER_OP
 }
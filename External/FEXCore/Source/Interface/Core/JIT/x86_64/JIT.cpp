@@ -576,6 +576,36 @@ std::tuple<X86JITCore::SetCC, X86JITCore::CMovCC, X86JITCore::JCC> X86JITCore::G
   return { &CodeGenerator::sete , &CodeGenerator::cmove , &CodeGenerator::je  };
 }
 
+void X86JITCore::EmitBlockExitSample() {
+  mov(rcx, reinterpret_cast<uintptr_t>(SamplingData));
+  // Get time
+  rdtsc();
+  shl(rdx, 32);
+  or_(rax, rdx);
+
+  // Calculate time spent in block
+  mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Start)]);
+  sub(rax, rdx);
+
+  // Add time to total time
+  add(qword [rcx + offsetof(BlockSamplingData::BlockData, TotalTime)], rax);
+
+  // Increment call count
+  inc(qword [rcx + offsetof(BlockSamplingData::BlockData, TotalCalls)]);
+
+  // Calculate min
+  mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Min)]);
+  cmp(rdx, rax);
+  cmova(rdx, rax);
+  mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Min)], rdx);
+
+  // Calculate max
+  mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Max)]);
+  cmp(rdx, rax);
+  cmovb(rdx, rax);
+  mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Max)], rdx);
+}
+
 void *X86JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRListView const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData, FEXCore::IR::RegisterAllocationData *RAData) {
   JumpTargets.clear();
   uint32_t SSACount = IR->GetSSACount();
@@ -619,9 +649,8 @@ void *X86JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRLi
     sub(rsp, SpillSlots * 16);
   }
 
-#ifdef BLOCKSTATS
-  BlockSamplingData::BlockData *SamplingData = CTX->BlockData->GetBlockData(Entry);
-  if (GetSamplingData) {
+  SamplingData = CTX->BlockData ? CTX->BlockData->GetBlockData(Entry) : nullptr;
+  if (SamplingData) {
     mov(rcx, reinterpret_cast<uintptr_t>(SamplingData));
     rdtsc();
     shl(rdx, 32);
@@ -629,39 +658,6 @@ void *X86JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRLi
     mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Start)], rax);
   }
 
-  auto ExitBlock = [&]() {
-    if (GetSamplingData) {
-      mov(rcx, reinterpret_cast<uintptr_t>(SamplingData));
-      // Get time
-      rdtsc();
-      shl(rdx, 32);
-      or_(rax, rdx);
-
-      // Calculate time spent in block
-      mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Start)]);
-      sub(rax, rdx);
-
-      // Add time to total time
-      add(qword [rcx + offsetof(BlockSamplingData::BlockData, TotalTime)], rax);
-
-      // Increment call count
-      inc(qword [rcx + offsetof(BlockSamplingData::BlockData, TotalCalls)]);
-
-      // Calculate min
-      mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Min)]);
-      cmp(rdx, rax);
-      cmova(rdx, rax);
-      mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Min)], rdx);
-
-      // Calculate max
-      mov(rdx, qword [rcx + offsetof(BlockSamplingData::BlockData, Max)]);
-      cmp(rdx, rax);
-      cmovb(rdx, rax);
-      mov(qword [rcx + offsetof(BlockSamplingData::BlockData, Max)], rdx);
-    }
-  };
-#endif
-
   PendingTargetLabel = nullptr;
 
   for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
@@ -135,9 +135,9 @@ private:
   IR::RegisterAllocationPass *RAPass;
   FEXCore::IR::RegisterAllocationData *RAData;
 
-#ifdef BLOCKSTATS
-  bool GetSamplingData {true};
-#endif
+  // Per-block counters when block stats are enabled
+  BlockSamplingData::BlockData *SamplingData{};
+  void EmitBlockExitSample();
 
   void EmplaceNewCodeBuffer(CodeBuffer Buffer) {
     CurrentCodeBuffer = &CodeBuffers.emplace_back(Buffer);
@@ -203,6 +203,7 @@ private:
   DEF_OP(InlineConstant);
   DEF_OP(InlineEntrypointOffset);
   DEF_OP(CycleCounter);
+  DEF_OP(RDRAND);
   DEF_OP(Add);
   DEF_OP(Sub);
   DEF_OP(Neg);
@@ -230,6 +231,7 @@ private:
   DEF_OP(Zext);
   DEF_OP(Not);
   DEF_OP(Popcount);
+  DEF_OP(CRC32);
   DEF_OP(FindLSB);
   DEF_OP(FindMSB);
   DEF_OP(FindTrailingZeros);
@@ -274,6 +276,7 @@ private:
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(RemoveCodeEntry);
+  DEF_OP(DebugBreakpoint);
   DEF_OP(CPUID);
 
   ///< Conversion ops
@@ -281,7 +284,6 @@ private:
   DEF_OP(VCastFromGPR);
   DEF_OP(Float_FromGPR_S);
   DEF_OP(Float_FToF);
-  DEF_OP(Vector_UToF);
   DEF_OP(Vector_SToF);
   DEF_OP(Vector_FToZS);
   DEF_OP(Vector_FToS);
@@ -304,11 +306,18 @@ private:
   DEF_OP(StoreMem);
   DEF_OP(VLoadMemElement);
   DEF_OP(VStoreMemElement);
+  DEF_OP(StringScan16);
+  DEF_OP(StringCompare16);
   DEF_OP(CacheLineClear);
+  DEF_OP(CacheLineClean);
+  DEF_OP(Prefetch);
+  DEF_OP(StoreMemNonTemporal);
 
   ///< Misc ops
   DEF_OP(EndBlock);
   DEF_OP(Fence);
+  DEF_OP(Yield);
+  DEF_OP(SpinWait);
   DEF_OP(Break);
   DEF_OP(Phi);
   DEF_OP(PhiValue);
@@ -324,8 +333,6 @@ private:
   ///< Vector ops
   DEF_OP(VectorZero);
   DEF_OP(VectorImm);
-  DEF_OP(CreateVector2);
-  DEF_OP(CreateVector4);
   DEF_OP(SplatVector);
   DEF_OP(VMov);
   DEF_OP(VAnd);
@@ -365,6 +372,9 @@ private:
   DEF_OP(VZip2);
   DEF_OP(VUnZip);
   DEF_OP(VUnZip2);
+  DEF_OP(VTrn);
+  DEF_OP(VTrn2);
+  DEF_OP(VRev64);
   DEF_OP(VBSL);
   DEF_OP(VCMPEQ);
   DEF_OP(VCMPEQZ);
@@ -420,6 +430,14 @@ private:
   DEF_OP(AESDec);
   DEF_OP(AESDecLast);
   DEF_OP(AESKeyGenAssist);
+  DEF_OP(PCLMULQDQ);
+  DEF_OP(SHA1Rnds4);
+  DEF_OP(SHA1NextE);
+  DEF_OP(SHA1Msg1);
+  DEF_OP(SHA1Msg2);
+  DEF_OP(SHA256Rnds2);
+  DEF_OP(SHA256Msg1);
+  DEF_OP(SHA256Msg2);
 #undef DEF_OP
 };
 
@@ -581,14 +581,120 @@ DEF_OP(VStoreMemElement) {
   LOGMAN_MSG_A_FMT("Unimplemented");
 }
 
+DEF_OP(StringScan16) {
+  auto Op = IROp->C<IR::IROp_StringScan16>();
+  Xbyak::Reg MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
+
+  // Broadcast the byte with a zero shuffle
+  vmovd(xmm15, GetSrc<RA_32>(Op->Header.Args[1].ID()));
+  vpxor(xmm14, xmm14, xmm14);
+  vpshufb(xmm15, xmm15, xmm14);
+
+  vmovdqu(xmm14, ptr [MemReg]);
+  vpcmpeqb(xmm14, xmm14, xmm15);
+  vpmovmskb(eax, xmm14);
+
+  if (!Op->MatchEqual) {
+    xor_(eax, 0xFFFF);
+  }
+
+  // Bit 16 stands in when nothing matched
+  or_(eax, 0x1'0000);
+  bsf(GetDst<RA_32>(Node), eax);
+}
+
+DEF_OP(StringCompare16) {
+  auto Op = IROp->C<IR::IROp_StringCompare16>();
+
+  vmovdqu(xmm14, ptr [GetSrc<RA_64>(Op->Header.Args[0].ID())]);
+  vmovdqu(xmm15, ptr [GetSrc<RA_64>(Op->Header.Args[1].ID())]);
+  vpcmpeqb(xmm14, xmm14, xmm15);
+  vpmovmskb(eax, xmm14);
+
+  if (!Op->MatchEqual) {
+    xor_(eax, 0xFFFF);
+  }
+
+  // Bit 16 stands in when nothing matched
+  or_(eax, 0x1'0000);
+  bsf(GetDst<RA_32>(Node), eax);
+}
+
 DEF_OP(CacheLineClear) {
   auto Op = IROp->C<IR::IROp_CacheLineClear>();
 
   Xbyak::Reg MemReg = GetSrc<RA_64>(Op->Addr.ID());
 
+  // CLFLUSHOPT isn't guaranteed on the host, the stronger ordering of CLFLUSH is always valid for it
   clflush(ptr [MemReg]);
 }
 
+DEF_OP(CacheLineClean) {
+  auto Op = IROp->C<IR::IROp_CacheLineClean>();
+
+  Xbyak::Reg MemReg = GetSrc<RA_64>(Op->Addr.ID());
+
+  // Same for CLWB, a flush is always a valid write back
+  clflush(ptr [MemReg]);
+}
+
+DEF_OP(Prefetch) {
+  auto Op = IROp->C<IR::IROp_Prefetch>();
+
+  Xbyak::Reg MemReg = GetSrc<RA_64>(Op->Addr.ID());
+
+  if (Op->ForStore) {
+    prefetchw(ptr [MemReg]);
+  }
+  else if (Op->Stream) {
+    prefetchnta(ptr [MemReg]);
+  }
+  else {
+    switch (Op->CacheLevel) {
+      case 1: prefetcht0(ptr [MemReg]); break;
+      case 2: prefetcht1(ptr [MemReg]); break;
+      default: prefetcht2(ptr [MemReg]); break;
+    }
+  }
+}
+
+DEF_OP(StoreMemNonTemporal) {
+  auto Op = IROp->C<IR::IROp_StoreMemNonTemporal>();
+
+  Xbyak::Reg MemReg = GetSrc<RA_64>(Op->Addr.ID());
+
+  if (Op->Class == FEXCore::IR::GPRClass) {
+    switch (Op->Size) {
+      case 4:
+        movnti(dword [MemReg], GetSrc<RA_32>(Op->Value.ID()));
+        break;
+      case 8:
+        movnti(qword [MemReg], GetSrc<RA_64>(Op->Value.ID()));
+        break;
+      default:  LOGMAN_MSG_A_FMT("Unhandled StoreMemNonTemporal size: {}", Op->Size);
+    }
+  }
+  else {
+    switch (Op->Size) {
+      case 4:
+        vmovd(dword [MemReg], GetSrc(Op->Value.ID()));
+        break;
+      case 8:
+        vmovq(qword [MemReg], GetSrc(Op->Value.ID()));
+        break;
+      case 16:
+        if (Op->Align >= 16) {
+          vmovntdq(xword [MemReg], GetSrc(Op->Value.ID()));
+        }
+        else {
+          vmovdqu(xword [MemReg], GetSrc(Op->Value.ID()));
+        }
+        break;
+      default:  LOGMAN_MSG_A_FMT("Unhandled StoreMemNonTemporal size: {}", Op->Size);
+    }
+  }
+}
+
 #undef DEF_OP
 void X86JITCore::RegisterMemoryHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &X86JITCore::Op_##x
@@ -608,7 +714,12 @@ void X86JITCore::RegisterMemoryHandlers() {
   REGISTER_OP(STOREMEMTSO,         StoreMem);
   REGISTER_OP(VLOADMEMELEMENT,     VLoadMemElement);
   REGISTER_OP(VSTOREMEMELEMENT,    VStoreMemElement);
+  REGISTER_OP(STRINGSCAN16,        StringScan16);
+  REGISTER_OP(STRINGCOMPARE16,     StringCompare16);
   REGISTER_OP(CACHELINECLEAR,      CacheLineClear);
+  REGISTER_OP(CACHELINECLEAN,      CacheLineClean);
+  REGISTER_OP(PREFETCH,            Prefetch);
+  REGISTER_OP(STOREMEMNONTEMPORAL, StoreMemNonTemporal);
 #undef REGISTER_OP
 }
 }
@@ -34,6 +34,15 @@ DEF_OP(Fence) {
   }
 }
 
+DEF_OP(Yield) {
+  pause();
+}
+
+DEF_OP(SpinWait) {
+  // Same as what the guest asked for, the host handles the spin-wait itself
+  pause();
+}
+
 DEF_OP(Break) {
   auto Op = IROp->C<IR::IROp_Break>();
   switch (Op->Reason) {
@@ -150,6 +159,8 @@ void X86JITCore::RegisterMiscHandlers() {
   REGISTER_OP(BEGINBLOCK, NoOp);
   REGISTER_OP(ENDBLOCK,   NoOp);
   REGISTER_OP(FENCE,      Fence);
+  REGISTER_OP(YIELD,      Yield);
+  REGISTER_OP(SPINWAIT,   SpinWait);
   REGISTER_OP(BREAK,      Break);
   REGISTER_OP(PHI,        NoOp);
   REGISTER_OP(PHIVALUE,   NoOp);
@@ -7,6 +7,8 @@ $end_info$
 #include "Interface/Core/JIT/x86_64/JITClass.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 
+#include <array>
+#include <cstring>
 
 namespace FEXCore::CPU {
 
@@ -61,14 +63,6 @@ DEF_OP(VectorImm) {
   }
 }
 
-DEF_OP(CreateVector2) {
-  LOGMAN_MSG_A_FMT("Unimplemented");
-}
-
-DEF_OP(CreateVector4) {
-  LOGMAN_MSG_A_FMT("Unimplemented");
-}
-
 DEF_OP(SplatVector) {
   auto Op = IROp->C<IR::IROp_SplatVector2>();
   uint8_t OpSize = IROp->Size;
@@ -1090,6 +1084,88 @@ DEF_OP(VUnZip2) {
 }
 
 
+// Byte shuffle mask that moves the source elements picked by Element in to each result element, 0x80 zeroes the byte
+template<typename F>
+static std::array<uint64_t, 2> ElementShuffleMask(uint8_t OpSize, uint8_t ElementSize, F Element) {
+  std::array<uint8_t, 16> Mask;
+  Mask.fill(0x80);
+  for (uint8_t i = 0; i < OpSize / ElementSize; ++i) {
+    int Source = Element(i);
+    if (Source < 0) {
+      continue;
+    }
+    for (uint8_t Byte = 0; Byte < ElementSize; ++Byte) {
+      Mask[i * ElementSize + Byte] = Source * ElementSize + Byte;
+    }
+  }
+
+  std::array<uint64_t, 2> Result;
+  memcpy(Result.data(), Mask.data(), sizeof(Mask));
+  return Result;
+}
+
+DEF_OP(VTrn) {
+  auto Op = IROp->C<IR::IROp_VTrn>();
+  uint8_t OpSize = IROp->Size;
+  uint8_t ElementSize = Op->Header.ElementSize;
+
+  // Even elements come from the lower source, odd elements from the upper
+  auto LowerMask = ElementShuffleMask(OpSize, ElementSize, [](uint8_t i) { return i & 1 ? -1 : i; });
+  auto UpperMask = ElementShuffleMask(OpSize, ElementSize, [](uint8_t i) { return i & 1 ? i - 1 : -1; });
+
+  mov(rax, LowerMask[0]);
+  mov(rcx, LowerMask[1]);
+  vmovq(xmm15, rax);
+  pinsrq(xmm15, rcx, 1);
+  vpshufb(xmm14, GetSrc(Op->Header.Args[0].ID()), xmm15);
+
+  mov(rax, UpperMask[0]);
+  mov(rcx, UpperMask[1]);
+  vmovq(xmm15, rax);
+  pinsrq(xmm15, rcx, 1);
+  vpshufb(xmm13, GetSrc(Op->Header.Args[1].ID()), xmm15);
+
+  vpor(GetDst(Node), xmm14, xmm13);
+}
+
+DEF_OP(VTrn2) {
+  auto Op = IROp->C<IR::IROp_VTrn2>();
+  uint8_t OpSize = IROp->Size;
+  uint8_t ElementSize = Op->Header.ElementSize;
+
+  auto LowerMask = ElementShuffleMask(OpSize, ElementSize, [](uint8_t i) { return i & 1 ? -1 : i + 1; });
+  auto UpperMask = ElementShuffleMask(OpSize, ElementSize, [](uint8_t i) { return i & 1 ? i : -1; });
+
+  mov(rax, LowerMask[0]);
+  mov(rcx, LowerMask[1]);
+  vmovq(xmm15, rax);
+  pinsrq(xmm15, rcx, 1);
+  vpshufb(xmm14, GetSrc(Op->Header.Args[0].ID()), xmm15);
+
+  mov(rax, UpperMask[0]);
+  mov(rcx, UpperMask[1]);
+  vmovq(xmm15, rax);
+  pinsrq(xmm15, rcx, 1);
+  vpshufb(xmm13, GetSrc(Op->Header.Args[1].ID()), xmm15);
+
+  vpor(GetDst(Node), xmm14, xmm13);
+}
+
+DEF_OP(VRev64) {
+  auto Op = IROp->C<IR::IROp_VRev64>();
+  uint8_t OpSize = IROp->Size;
+  uint8_t ElementSize = Op->Header.ElementSize;
+  uint8_t ElementsPer64 = 8 / ElementSize;
+
+  auto Mask = ElementShuffleMask(OpSize, ElementSize, [ElementsPer64](uint8_t i) { return i ^ (ElementsPer64 - 1); });
+
+  mov(rax, Mask[0]);
+  mov(rcx, Mask[1]);
+  vmovq(xmm15, rax);
+  pinsrq(xmm15, rcx, 1);
+  vpshufb(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), xmm15);
+}
+
 DEF_OP(VBSL) {
   auto Op = IROp->C<IR::IROp_VBSL>();
   vpand(xmm0, GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[1].ID()));
@@ -2150,8 +2226,6 @@ void X86JITCore::RegisterVectorHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &X86JITCore::Op_##x
   REGISTER_OP(VECTORZERO,        VectorZero);
   REGISTER_OP(VECTORIMM,         VectorImm);
-  REGISTER_OP(CREATEVECTOR2,     CreateVector2);
-  REGISTER_OP(CREATEVECTOR4,     CreateVector4);
   REGISTER_OP(SPLATVECTOR2,      SplatVector);
   REGISTER_OP(SPLATVECTOR4,      SplatVector);
   REGISTER_OP(VMOV,              VMov);
@@ -2192,6 +2266,9 @@ void X86JITCore::RegisterVectorHandlers() {
   REGISTER_OP(VZIP2,             VZip2);
   REGISTER_OP(VUNZIP,            VUnZip);
   REGISTER_OP(VUNZIP2,           VUnZip2);
+  REGISTER_OP(VTRN,              VTrn);
+  REGISTER_OP(VTRN2,             VTrn2);
+  REGISTER_OP(VREV64,            VRev64);
   REGISTER_OP(VBSL,              VBSL);
   REGISTER_OP(VCMPEQ,            VCMPEQ);
   REGISTER_OP(VCMPEQZ,           VCMPEQZ);
@@ -12,6 +12,10 @@ $end_info$
 
 #include <sys/mman.h>
 
+#ifndef MADV_WIPEONFORK
+#define MADV_WIPEONFORK 18
+#endif
+
 namespace FEXCore {
 LookupCache::LookupCache(FEXCore::Context::Context *CTX)
   : ctx {CTX} {
@@ -43,6 +47,13 @@ LookupCache::LookupCache(FEXCore::Context::Context *CTX)
   LOGMAN_THROW_A(L1Pointer != -1ULL, "Failed to allocate L1Pointer");
 
   VirtualMemSize = ctx->Config.VirtualMemSize;
+
+  // A forked child gets these zeroed instead of having their page tables copied
+  // Zero is an empty cache, the live thread refills it from BlockList and the dead threads never touch it
+  // Older kernels don't support this, which only costs fork time
+  madvise(reinterpret_cast<void*>(PagePointer), ctx->Config.VirtualMemSize / 4096 * 8, MADV_WIPEONFORK);
+  madvise(reinterpret_cast<void*>(PageMemory), CODE_SIZE, MADV_WIPEONFORK);
+  madvise(reinterpret_cast<void*>(L1Pointer), L1_SIZE, MADV_WIPEONFORK);
 }
 
 LookupCache::~LookupCache() {
@@ -101,6 +101,9 @@ void OpDispatchBuilder::SyscallOp(OpcodeArgs) {
     _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs) + GPRIndicesRef[6] * 8, GPRClass));
 
   _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RAX]), SyscallOp);
+
+  // arch_prctl and set_thread_area can change segment bases behind our back
+  InvalidateSegmentBaseCache();
 }
 
 void OpDispatchBuilder::ThunkOp(OpcodeArgs) {
@@ -112,6 +115,8 @@ void OpDispatchBuilder::ThunkOp(OpcodeArgs) {
     *reinterpret_cast<SHA256Sum*>(sha256)
   );
 
+  InvalidateSegmentBaseCache();
+
   auto Constant = _Constant(GPRSize);
   auto OldSP = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSP]), GPRClass);
   auto NewRIP = _LoadMem(GPRClass, GPRSize, OldSP, GPRSize);
@@ -663,6 +668,8 @@ void OpDispatchBuilder::POPSegmentOp(OpcodeArgs) {
       break;
     default: break; // Do nothing
   }
+
+  InvalidateSegmentBaseCache();
 }
 
 void OpDispatchBuilder::LEAVEOp(OpcodeArgs) {
@@ -1347,6 +1354,10 @@ void OpDispatchBuilder::XCHGOp(OpcodeArgs) {
     // But this would result in a zext on 64bit, which would ruin the no-op nature of the instruction
     // So x86-64 spec mandates this special case that even though it is a 32bit instruction and
     // is supposed to zext the result, it is a true no-op
+    if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX) {
+      // F3 90 is PAUSE
+      PAUSEOp(Op);
+    }
     return;
   }
 
@@ -1370,6 +1381,129 @@ void OpDispatchBuilder::XCHGOp(OpcodeArgs) {
   }
 }
 
+std::optional<OpDispatchBuilder::SpinLoopInfo> OpDispatchBuilder::FindSpinLoop(OpcodeArgs) {
+  auto IsMem = [](FEXCore::X86Tables::DecodedOperand const &Operand) {
+    return Operand.IsGPRDirect() || Operand.IsGPRIndirect() || Operand.IsRIPRelative() || Operand.IsSIB();
+  };
+
+  auto AddressUsesGPR = [](FEXCore::X86Tables::DecodedOperand const &Operand, uint8_t GPR) {
+    if (Operand.IsGPRDirect()) {
+      return Operand.Data.GPR.GPR == GPR;
+    }
+    if (Operand.IsGPRIndirect()) {
+      return Operand.Data.GPRIndirect.GPR == GPR;
+    }
+    if (Operand.IsSIB()) {
+      return Operand.Data.SIB.Base == GPR || Operand.Data.SIB.Index == GPR;
+    }
+    return false;
+  };
+
+  for (auto &Block : *DecodedFunctionBlocks) {
+    auto First = Block.DecodedInstructions;
+    auto Last = &Block.DecodedInstructions[Block.NumInstructions - 1];
+    if (Op < First || Op > Last) {
+      continue;
+    }
+
+    // PAUSE, the branch and one or two instructions to load and compare
+    if (Block.NumInstructions < 3 || Block.NumInstructions > 4) {
+      return std::nullopt;
+    }
+
+    // The whole block must be the loop body
+    if (Last->TableInfo->OpcodeDispatcher != &OpDispatchBuilder::CondJUMPOp ||
+        (Last->PC + Last->InstSize + Last->Src[0].Data.Literal.Value) != Block.Entry) {
+      return std::nullopt;
+    }
+
+    FEXCore::X86Tables::DecodedOp Load{};
+    FEXCore::X86Tables::DecodedOp Compare{};
+    for (auto Inst = First; Inst != Last; ++Inst) {
+      if (Inst == Op) {
+        continue;
+      }
+
+      if (Inst->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_LOCK) {
+        return std::nullopt;
+      }
+
+      auto Dispatcher = Inst->TableInfo->OpcodeDispatcher;
+      if (!Load && !Compare &&
+          Dispatcher == &OpDispatchBuilder::MOVGPROp<0> &&
+          Inst->OP == 0x8B && IsMem(Inst->Src[0])) {
+        Load = Inst;
+      }
+      else if (!Compare &&
+               (Dispatcher == &OpDispatchBuilder::CMPOp<0> ||
+                Dispatcher == &OpDispatchBuilder::CMPOp<1> ||
+                Dispatcher == &OpDispatchBuilder::TESTOp<0>)) {
+        Compare = Inst;
+      }
+      else {
+        return std::nullopt;
+      }
+    }
+
+    if (!Compare) {
+      return std::nullopt;
+    }
+
+    if (Load) {
+      // mov reg, [mem]; cmp/test reg, ...
+      // The polled address can't depend on the loaded value and the compare can't touch memory
+      const uint8_t GPR = Load->Dest.Data.GPR.GPR;
+      const uint8_t Size = GetSrcSize(Load);
+      if (Size < 4 ||
+          AddressUsesGPR(Load->Src[0], GPR) ||
+          IsMem(Compare->Dest) || IsMem(Compare->Src[0]) ||
+          !((Compare->Dest.IsGPR() && Compare->Dest.Data.GPR.GPR == GPR) ||
+            (Compare->Src[0].IsGPR() && Compare->Src[0].Data.GPR.GPR == GPR))) {
+        return std::nullopt;
+      }
+
+      return SpinLoopInfo{Load, &Load->Src[0], &Load->Dest, Size};
+    }
+
+    // cmp [mem], reg/imm or cmp reg, [mem]
+    if (IsMem(Compare->Dest)) {
+      return SpinLoopInfo{Compare, &Compare->Dest, nullptr, GetSrcSize(Compare)};
+    }
+    if (IsMem(Compare->Src[0])) {
+      return SpinLoopInfo{Compare, &Compare->Src[0], nullptr, GetSrcSize(Compare)};
+    }
+    return std::nullopt;
+  }
+
+  return std::nullopt;
+}
+
+void OpDispatchBuilder::PAUSEOp(OpcodeArgs) {
+  auto SpinLoop = FindSpinLoop(Op);
+  if (!SpinLoop) {
+    // Not a recognized spin loop, let the host know that we are spinning
+    _Yield();
+    return;
+  }
+
+  // Wait for the polled location to change instead of spinning on it
+  // The guest loop still does its own check afterwards so waking up early is harmless
+  auto Inst = SpinLoop->Inst;
+  OrderedNode *Addr = LoadSource_WithOpSize(GPRClass, Inst, *SpinLoop->Mem, SpinLoop->Size, Inst->Flags, -1, false);
+  Addr = AppendSegmentOffset(Addr, Inst->Flags);
+
+  OrderedNode *Expected{};
+  if (SpinLoop->Value) {
+    // Compare against the value the guest last saw so a change right before the wait isn't missed
+    Expected = LoadSource_WithOpSize(GPRClass, Inst, *SpinLoop->Value, SpinLoop->Size, Inst->Flags, -1);
+  }
+  else {
+    Expected = _LoadMemAutoTSO(GPRClass, SpinLoop->Size, Addr, SpinLoop->Size);
+  }
+
+  _SpinWait(Addr, Expected, SpinLoop->Size);
+}
+
 void OpDispatchBuilder::CDQOp(OpcodeArgs) {
   OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
   uint8_t DstSize = GetDstSize(Op);
@@ -1507,6 +1641,8 @@ void OpDispatchBuilder::MOVSegOp(OpcodeArgs) {
         DecodeFailure = true;
         break;
     }
+
+    InvalidateSegmentBaseCache();
   }
   else {
     OrderedNode *Segment{};
@@ -2992,6 +3128,8 @@ void OpDispatchBuilder::WriteSegmentReg(OpcodeArgs) {
   else {
     _StoreContext(GPRClass, Size, offsetof(FEXCore::Core::CPUState, gs), Src);
   }
+
+  InvalidateSegmentBaseCache();
 }
 
 void OpDispatchBuilder::EnterOp(OpcodeArgs) {
@@ -3033,14 +3171,55 @@ void OpDispatchBuilder::EnterOp(OpcodeArgs) {
   _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RBP]), temp_RBP);
 }
 
+OrderedNode *OpDispatchBuilder::LoadGuestTSC() {
+  if (CTX->Config.Deterministic) {
+    // Counts retired guest instructions, advanced on each block entry
+    return _LoadContext(8, offsetof(FEXCore::Core::CPUState, VirtualTSC), GPRClass);
+  }
+
+  OrderedNode *Counter = _CycleCounter();
+
+  // Rescale the host counter so the guest TSC ticks at the frequency reported through CPUID
+  auto &Scale = CTX->CPUID.GetTSCScale();
+  if (!Scale.IsIdentity()) {
+    OrderedNode *Result{};
+    if (Scale.Integer) {
+      Result = _Mul(Counter, _Constant(Scale.Integer));
+    }
+    if (Scale.Fraction) {
+      auto FractionPart = _UMulH(Counter, _Constant(Scale.Fraction));
+      Result = Result ? _Add(Result, FractionPart) : FractionPart;
+    }
+    Counter = Result;
+  }
+
+  return Counter;
+}
+
 void OpDispatchBuilder::RDTSCOp(OpcodeArgs) {
   const uint8_t GPRSize = CTX->GetGPRSize();
 
-  auto Counter = _CycleCounter();
+  auto Counter = LoadGuestTSC();
+  auto CounterLow = _Bfe(32, 0, Counter);
+  auto CounterHigh = _Bfe(32, 32, Counter);
+  _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RAX]), CounterLow);
+  _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDX]), CounterHigh);
+}
+
+void OpDispatchBuilder::RDTSCPOp(OpcodeArgs) {
+  const uint8_t GPRSize = CTX->GetGPRSize();
+
+  // RDTSCP waits for prior loads to be globally visible before reading the counter
+  _Fence(FEXCore::IR::Fence_Load);
+
+  auto Counter = LoadGuestTSC();
   auto CounterLow = _Bfe(32, 0, Counter);
   auto CounterHigh = _Bfe(32, 32, Counter);
   _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RAX]), CounterLow);
   _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDX]), CounterHigh);
+
+  // TSC_AUX is the processor ID, which isn't tracked. Always report CPU 0
+  _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Constant(0));
 }
 
 void OpDispatchBuilder::INCOp(OpcodeArgs) {
@@ -3317,6 +3496,88 @@ void OpDispatchBuilder::MOVSOp(OpcodeArgs) {
   }
 }
 
+/**
+ * @brief Creates the blocks that skip through a REP SCASB/CMPSB loop 16 bytes at a time
+ *
+ * Sits between the RCX == 0 check and the scalar body of the loop.
+ * Only runs when DF is clear, more than 16 elements are left and none of the 16 byte ranges cross a page,
+ * so it never touches a page that the scalar loop wouldn't have. It only steps over elements that can't end the loop.
+ * The element that ends it, and always the final element, still go through the scalar body.
+ * That keeps RCX, RSI, RDI and the flags exactly as the scalar loop leaves them.
+ *
+ * @return The block the loop should enter when RCX != 0
+ */
+OrderedNode *OpDispatchBuilder::GenerateStringVectorStep(OpcodeArgs, bool IsCompare, bool MatchEqual, OrderedNode *DF, OrderedNode *LoopStart, OrderedNode *ScalarBody) {
+  const auto GPRSize = CTX->GetGPRSize();
+
+  auto VectorCheck = CreateNewCodeBlockAfter(LoopStart);
+  auto VectorBody = CreateNewCodeBlockAfter(VectorCheck);
+
+  auto InPage = [this](OrderedNode *Addr) -> OrderedNode* {
+    return _Select(FEXCore::IR::COND_ULE,
+        _And(Addr, _Constant(0xFFF)), _Constant(0x1000 - 16),
+        _Constant(1), _Constant(0));
+  };
+
+  SetCurrentCodeBlock(VectorCheck);
+  {
+    OrderedNode *Counter = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    OrderedNode *Dest_RDI = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+    Dest_RDI = AppendSegmentOffset(Dest_RDI, 0, FEXCore::X86Tables::DecodeFlags::FLAG_ES_PREFIX, true);
+
+    OrderedNode *CanVector = _Select(FEXCore::IR::COND_UGT,
+        Counter, _Constant(16),
+        _Constant(1), _Constant(0));
+    CanVector = _And(CanVector, _Select(FEXCore::IR::COND_EQ,
+        DF, _Constant(0),
+        _Constant(1), _Constant(0)));
+    CanVector = _And(CanVector, InPage(Dest_RDI));
+
+    if (IsCompare) {
+      OrderedNode *Dest_RSI = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
+      Dest_RSI = AppendSegmentOffset(Dest_RSI, Op->Flags, FEXCore::X86Tables::DecodeFlags::FLAG_DS_PREFIX);
+      CanVector = _And(CanVector, InPage(Dest_RSI));
+    }
+
+    _CondJump(CanVector, VectorBody, ScalarBody, {COND_NEQ});
+  }
+
+  SetCurrentCodeBlock(VectorBody);
+  {
+    OrderedNode *RDI = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+    OrderedNode *RSI{};
+    OrderedNode *Dest_RDI = AppendSegmentOffset(RDI, 0, FEXCore::X86Tables::DecodeFlags::FLAG_ES_PREFIX, true);
+    OrderedNode *Index{};
+
+    if (IsCompare) {
+      RSI = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
+      OrderedNode *Dest_RSI = AppendSegmentOffset(RSI, Op->Flags, FEXCore::X86Tables::DecodeFlags::FLAG_DS_PREFIX);
+      Index = _StringCompare16(Dest_RSI, Dest_RDI, MatchEqual);
+    }
+    else {
+      OrderedNode *Value = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+      Index = _StringScan16(Dest_RDI, Value, MatchEqual);
+    }
+
+    // The scalar loads are acquires under TSO, the vector loads need a barrier to match
+    if (CTX->Config.TSOEnabled) {
+      _Fence({FEXCore::IR::Fence_Load});
+    }
+
+    OrderedNode *Counter = _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Sub(Counter, Index));
+    _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), _Add(RDI, Index));
+    if (IsCompare) {
+      _StoreContext(GPRClass, GPRSize, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), _Add(RSI, Index));
+    }
+
+    // Nothing matched so keep going, otherwise the scalar body handles the element that ends the loop
+    _CondJump(Index, _Constant(16), LoopStart, ScalarBody, {COND_EQ}, 8);
+  }
+
+  return VectorCheck;
+}
+
 void OpDispatchBuilder::CMPSOp(OpcodeArgs) {
   if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_ADDRESS_SIZE) {
     LogMan::Msg::E("Can't handle adddress size");
@@ -3381,7 +3642,12 @@ void OpDispatchBuilder::CMPSOp(OpcodeArgs) {
     IRPair<IROp_CondJump> InternalCondJump;
 
     auto LoopTail = CreateNewCodeBlockAfter(LoopStart);
-    SetFalseJumpTarget(CondJump, LoopTail);
+    if (Size == 1) {
+      SetFalseJumpTarget(CondJump, GenerateStringVectorStep(Op, true, !REPE, DF, LoopStart, LoopTail));
+    }
+    else {
+      SetFalseJumpTarget(CondJump, LoopTail);
+    }
     SetCurrentCodeBlock(LoopTail);
 
     // Working loop
@@ -3602,7 +3868,12 @@ void OpDispatchBuilder::SCASOp(OpcodeArgs) {
     IRPair<IROp_CondJump> InternalCondJump;
 
     auto LoopTail = CreateNewCodeBlockAfter(LoopStart);
-    SetFalseJumpTarget(CondJump, LoopTail);
+    if (Size == 1) {
+      SetFalseJumpTarget(CondJump, GenerateStringVectorStep(Op, false, !REPE, DF, LoopStart, LoopTail));
+    }
+    else {
+      SetFalseJumpTarget(CondJump, LoopTail);
+    }
     SetCurrentCodeBlock(LoopTail);
 
     // Working loop
@@ -4104,6 +4375,7 @@ void OpDispatchBuilder::CreateJumpBlocks(std::vector<FEXCore::Frontend::Decoder:
 
 void OpDispatchBuilder::BeginFunction(uint64_t RIP, std::vector<FEXCore::Frontend::Decoder::DecodedBlocks> const *Blocks) {
   Entry = RIP;
+  DecodedFunctionBlocks = Blocks;
   auto IRHeader = _IRHeader(InvalidNode, 0);
   Current_Header = IRHeader.first;
   Current_HeaderNode = IRHeader;
@@ -4171,20 +4443,56 @@ uint8_t OpDispatchBuilder::GetSrcSize(FEXCore::X86Tables::DecodedOp Op) const {
   return Size;
 }
 
-OrderedNode *OpDispatchBuilder::AppendSegmentOffset(OrderedNode *Value, uint32_t Flags, uint32_t DefaultPrefix, bool Override) {
-  const uint8_t GPRSize = CTX->GetGPRSize();
+OrderedNode *OpDispatchBuilder::LoadSegmentBase(uint32_t Prefix) {
+  // Segment bases only change through selector writes, WRFSBASE/WRGSBASE or syscalls (arch_prctl, set_thread_area)
+  // Every one of those invalidates the cache, so within a code block we can reuse the base we already calculated
+  if (CachedSegmentBlock != GetCurrentBlock()) {
+    CachedSegmentBase.fill(nullptr);
+    CachedSegmentBlock = GetCurrentBlock();
+  }
+
+  const size_t Index = std::countr_zero(Prefix) - std::countr_zero(FEXCore::X86Tables::DecodeFlags::FLAG_ES_PREFIX);
+  LOGMAN_THROW_A(Index < CachedSegmentBase.size(), "Invalid segment prefix");
 
+  if (CachedSegmentBase[Index]) {
+    return CachedSegmentBase[Index];
+  }
+
+  static constexpr std::array<uint32_t, 6> SegmentOffsets = {
+    offsetof(FEXCore::Core::CPUState, es),
+    offsetof(FEXCore::Core::CPUState, cs),
+    offsetof(FEXCore::Core::CPUState, ss),
+    offsetof(FEXCore::Core::CPUState, ds),
+    offsetof(FEXCore::Core::CPUState, fs),
+    offsetof(FEXCore::Core::CPUState, gs),
+  };
+
+  OrderedNode *Base{};
+  if (CTX->Config.Is64BitMode) {
+    // In 64bit mode FS and GS hold the segment base directly
+    Base = _LoadContext(CTX->GetGPRSize(), SegmentOffsets[Index], GPRClass);
+  }
+  else {
+    auto Segment = _LoadContext(2, SegmentOffsets[Index], GPRClass);
+    Segment = _Lshr(Segment, _Constant(3));
+    Base = _LoadContextIndexed(Segment, 4, offsetof(FEXCore::Core::CPUState, gdt[0]), 4, GPRClass);
+  }
+
+  CachedSegmentBase[Index] = Base;
+  return Base;
+}
+
+OrderedNode *OpDispatchBuilder::AppendSegmentOffset(OrderedNode *Value, uint32_t Flags, uint32_t DefaultPrefix, bool Override) {
   if (CTX->Config.Is64BitMode) {
     if (Flags & FEXCore::X86Tables::DecodeFlags::FLAG_FS_PREFIX) {
-      Value = _Add(Value, _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, fs), GPRClass));
+      Value = _Add(Value, LoadSegmentBase(FEXCore::X86Tables::DecodeFlags::FLAG_FS_PREFIX));
     }
     else if (Flags & FEXCore::X86Tables::DecodeFlags::FLAG_GS_PREFIX) {
-      Value = _Add(Value, _LoadContext(GPRSize, offsetof(FEXCore::Core::CPUState, gs), GPRClass));
+      Value = _Add(Value, LoadSegmentBase(FEXCore::X86Tables::DecodeFlags::FLAG_GS_PREFIX));
     }
     // If there was any other segment in 64bit then it is ignored
   }
   else {
-    OrderedNode *Segment{};
     uint32_t Prefix = Flags & FEXCore::X86Tables::DecodeFlags::FLAG_SEGMENTS;
     if (!Prefix || Override) {
       // If there was no prefix then use the default one if available
@@ -4193,31 +4501,15 @@ OrderedNode *OpDispatchBuilder::AppendSegmentOffset(OrderedNode *Value, uint32_t
     }
     switch (Prefix) {
       case FEXCore::X86Tables::DecodeFlags::FLAG_ES_PREFIX:
-        Segment = _LoadContext(2, offsetof(FEXCore::Core::CPUState, es), GPRClass);
-        break;
       case FEXCore::X86Tables::DecodeFlags::FLAG_CS_PREFIX:
-        Segment = _LoadContext(2, offsetof(FEXCore::Core::CPUState, cs), GPRClass);
-        break;
       case FEXCore::X86Tables::DecodeFlags::FLAG_SS_PREFIX:
-        Segment = _LoadContext(2, offsetof(FEXCore::Core::CPUState, ss), GPRClass);
-        break;
       case FEXCore::X86Tables::DecodeFlags::FLAG_DS_PREFIX:
-        Segment = _LoadContext(2, offsetof(FEXCore::Core::CPUState, ds), GPRClass);
-        break;
       case FEXCore::X86Tables::DecodeFlags::FLAG_FS_PREFIX:
-        Segment = _LoadContext(2, offsetof(FEXCore::Core::CPUState, fs), GPRClass);
-        break;
       case FEXCore::X86Tables::DecodeFlags::FLAG_GS_PREFIX:
-        Segment = _LoadContext(2, offsetof(FEXCore::Core::CPUState, gs), GPRClass);
+        Value = _Add(Value, LoadSegmentBase(Prefix));
         break;
       default: break; // Do nothing
     }
-
-    if (Segment) {
-      Segment = _Lshr(Segment, _Constant(3));
-      auto data = _LoadContextIndexed(Segment, 4, offsetof(FEXCore::Core::CPUState, gdt[0]), 4, GPRClass);
-      Value = _Add(Value, data);
-    }
   }
 
   return Value;
@@ -4516,6 +4808,9 @@ void OpDispatchBuilder::ResetWorkingList() {
   DecodeFailure = false;
   ShouldDump = false;
   CurrentCodeBlock = nullptr;
+  InvalidateSegmentBaseCache();
+  CachedFCWBlock = nullptr;
+  CachedShuffleIndicesBlock = nullptr;
 }
 
 void OpDispatchBuilder::UnhandledOp(OpcodeArgs) {
@@ -4760,6 +5055,44 @@ void OpDispatchBuilder::MOVBEOp(OpcodeArgs) {
   StoreResult(GPRClass, Op, Src, 1);
 }
 
+void OpDispatchBuilder::CRC32Op(OpcodeArgs) {
+  // Without host CRC32 this behaves like a CPU without SSE4.2, the backends have no fallback
+  if (!CTX->HostFeatures.SupportsCRC) {
+    UnimplementedOp(Op);
+    return;
+  }
+
+  // The accumulator is always 32bit, an operand size prefix only narrows the source
+  OrderedNode *Crc = LoadSource_WithOpSize(GPRClass, Op, Op->Dest, 4, Op->Flags, -1);
+  OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+
+  // REX.W only zero extends the result to 64bit, which a 32bit store already does
+  StoreResult_WithOpSize(GPRClass, Op, Op->Dest, _CRC32(Crc, Src, GetSrcSize(Op)), 4, -1);
+}
+
+void OpDispatchBuilder::RDRANDOp(OpcodeArgs) {
+  auto Zero = _Constant(0);
+
+  if (CTX->Config.Deterministic) {
+    // Deterministic runs don't advertise RDRAND, every read fails with a zero value
+    StoreResult(GPRClass, Op, Zero, -1);
+    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(Zero);
+  }
+  else {
+    auto Res = _RDRAND();
+    StoreResult(GPRClass, Op, _ExtractElementPair(Res, 0), -1);
+    // CF says if the value is valid
+    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_ExtractElementPair(Res, 1));
+  }
+
+  // The rest are always cleared
+  SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(Zero);
+  SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(Zero);
+  SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(Zero);
+  SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(Zero);
+  SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(Zero);
+}
+
 template<uint8_t FenceType>
 void OpDispatchBuilder::FenceOp(OpcodeArgs) {
   _Fence({FenceType});
@@ -4774,10 +5107,55 @@ void OpDispatchBuilder::StoreFenceOrCLFlush(OpcodeArgs) {
     // This is a CLFlush
     OrderedNode *DestMem = LoadSource(GPRClass, Op, Op->Dest, Op->Flags, -1, false);
     DestMem = AppendSegmentOffset(DestMem, Op->Flags);
-    _CacheLineClear(DestMem);
+    _CacheLineClear(DestMem, true);
   }
 }
 
+void OpDispatchBuilder::CLFlushOptOp(OpcodeArgs) {
+  if (Op->Dest.IsGPR()) {
+    UnimplementedOp(Op);
+    return;
+  }
+
+  OrderedNode *DestMem = LoadSource(GPRClass, Op, Op->Dest, Op->Flags, -1, false);
+  DestMem = AppendSegmentOffset(DestMem, Op->Flags);
+  _CacheLineClear(DestMem, false);
+}
+
+void OpDispatchBuilder::CLWBOp(OpcodeArgs) {
+  if (Op->Dest.IsGPR()) {
+    UnimplementedOp(Op);
+    return;
+  }
+
+  OrderedNode *DestMem = LoadSource(GPRClass, Op, Op->Dest, Op->Flags, -1, false);
+  DestMem = AppendSegmentOffset(DestMem, Op->Flags);
+  _CacheLineClean(DestMem);
+}
+
+template<bool ForStore, bool Stream, uint8_t CacheLevel>
+void OpDispatchBuilder::PrefetchOp(OpcodeArgs) {
+  // The register forms are reserved NOPs
+  if (Op->Src[0].IsGPR()) {
+    return;
+  }
+
+  OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
+  Mem = AppendSegmentOffset(Mem, Op->Flags);
+  _Prefetch(Mem, ForStore, Stream, CacheLevel);
+}
+
+void OpDispatchBuilder::MOVNTOp(OpcodeArgs) {
+  // These only have a memory destination, the source register picks the class
+  const auto Class = Op->Src[0].Data.GPR.GPR <= FEXCore::X86State::REG_R15 ? GPRClass : FPRClass;
+  const uint8_t Size = GetDstSize(Op);
+
+  OrderedNode *Src = LoadSource(Class, Op, Op->Src[0], Op->Flags, -1);
+  OrderedNode *DestMem = LoadSource(GPRClass, Op, Op->Dest, Op->Flags, -1, false);
+  DestMem = AppendSegmentOffset(DestMem, Op->Flags);
+  _StoreMemNonTemporal(Class, Size, DestMem, Src, Size);
+}
+
 void OpDispatchBuilder::UnimplementedOp(OpcodeArgs) {
   const uint8_t GPRSize = CTX->GetGPRSize();
 
@@ -4920,7 +5298,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0xBD, 1, &OpDispatchBuilder::BSROp}, // BSF
     {0xBE, 2, &OpDispatchBuilder::MOVSXOp},
     {0xC0, 2, &OpDispatchBuilder::XADDOp},
-    {0xC3, 1, &OpDispatchBuilder::MOVGPROp<0>},
+    {0xC3, 1, &OpDispatchBuilder::MOVNTOp},
     {0xC4, 1, &OpDispatchBuilder::PINSROp<2>},
     {0xC5, 1, &OpDispatchBuilder::PExtrOp<2>},
     {0xC8, 8, &OpDispatchBuilder::BSWAPOp},
@@ -4934,7 +5312,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0x17, 1, &OpDispatchBuilder::MOVUPSOp},
     {0x28, 2, &OpDispatchBuilder::MOVUPSOp},
     {0x2A, 1, &OpDispatchBuilder::MMX_To_XMM_Vector_CVT_Int_To_Float<4, false>},
-    {0x2B, 1, &OpDispatchBuilder::MOVAPSOp},
+    {0x2B, 1, &OpDispatchBuilder::MOVNTOp},
     {0x2C, 1, &OpDispatchBuilder::Vector_CVT_Float_To_Int<4, false, false>},
     {0x2D, 1, &OpDispatchBuilder::Vector_CVT_Float_To_Int<4, false, true>},
     {0x2E, 2, &OpDispatchBuilder::UCOMISxOp<4>},
@@ -4996,7 +5374,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0xE3, 1, &OpDispatchBuilder::PAVGOp<2>},
     {0xE4, 1, &OpDispatchBuilder::PMULHW<false>},
     {0xE5, 1, &OpDispatchBuilder::PMULHW<true>},
-    {0xE7, 1, &OpDispatchBuilder::MOVUPSOp},
+    {0xE7, 1, &OpDispatchBuilder::MOVNTOp},
     {0xE8, 1, &OpDispatchBuilder::PSUBSOp<1, true>},
     {0xE9, 1, &OpDispatchBuilder::PSUBSOp<2, true>},
     {0xEA, 1, &OpDispatchBuilder::VectorALUOp<IR::OP_VSMIN, 2>},
@@ -5162,7 +5540,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0x16, 1, &OpDispatchBuilder::MOVSHDUPOp},
     {0x19, 7, &OpDispatchBuilder::NOPOp},
     {0x2A, 1, &OpDispatchBuilder::CVTGPR_To_FPR<4>},
-    {0x2B, 1, &OpDispatchBuilder::MOVVectorOp},
+    {0x2B, 1, &OpDispatchBuilder::MOVNTOp},
     {0x2C, 1, &OpDispatchBuilder::CVTFPR_To_GPR<4, false>},
     {0x2D, 1, &OpDispatchBuilder::CVTFPR_To_GPR<4, true>},
     {0x51, 1, &OpDispatchBuilder::VectorUnaryOp<IR::OP_VFSQRT, 4, true>},
@@ -5193,7 +5571,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0x12, 1, &OpDispatchBuilder::MOVDDUPOp},
     {0x19, 7, &OpDispatchBuilder::NOPOp},
     {0x2A, 1, &OpDispatchBuilder::CVTGPR_To_FPR<8>},
-    {0x2B, 1, &OpDispatchBuilder::MOVVectorOp},
+    {0x2B, 1, &OpDispatchBuilder::MOVNTOp},
     {0x2C, 1, &OpDispatchBuilder::CVTFPR_To_GPR<8, false>},
     {0x2D, 1, &OpDispatchBuilder::CVTFPR_To_GPR<8, true>},
     {0x51, 1, &OpDispatchBuilder::VectorUnaryOp<IR::OP_VFSQRT, 8, true>},
@@ -5224,7 +5602,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0x19, 7, &OpDispatchBuilder::NOPOp},
     {0x28, 2, &OpDispatchBuilder::MOVAPSOp},
     {0x2A, 1, &OpDispatchBuilder::MMX_To_XMM_Vector_CVT_Int_To_Float<4, true>},
-    {0x2B, 1, &OpDispatchBuilder::MOVAPSOp},
+    {0x2B, 1, &OpDispatchBuilder::MOVNTOp},
     {0x2C, 1, &OpDispatchBuilder::XMM_To_MMX_Vector_CVT_Float_To_Int<8, false>},
     {0x2D, 1, &OpDispatchBuilder::XMM_To_MMX_Vector_CVT_Float_To_Int<8, true>},
     {0x2E, 2, &OpDispatchBuilder::UCOMISxOp<8>},
@@ -5298,7 +5676,7 @@ void InstallOpcodeHandlers(Context::OperatingMode Mode) {
     {0xE4, 1, &OpDispatchBuilder::PMULHW<false>},
     {0xE5, 1, &OpDispatchBuilder::PMULHW<true>},
     {0xE6, 1, &OpDispatchBuilder::Vector_CVT_Float_To_Int<8, true, false>},
-    {0xE7, 1, &OpDispatchBuilder::MOVVectorOp},
+    {0xE7, 1, &OpDispatchBuilder::MOVNTOp},
     {0xE8, 1, &OpDispatchBuilder::VectorALUOp<IR::OP_VSQSUB, 1>},
     {0xE9, 1, &OpDispatchBuilder::VectorALUOp<IR::OP_VSQSUB, 2>},
     {0xEA, 1, &OpDispatchBuilder::VectorALUOp<IR::OP_VSMIN, 2>},
@@ -5353,6 +5731,8 @@ constexpr uint16_t PF_F2 = 3;
 
     // GROUP 9
     {OPD(FEXCore::X86Tables::TYPE_GROUP_9, PF_NONE, 1), 1, &OpDispatchBuilder::CMPXCHGPairOp},
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_9, PF_NONE, 6), 1, &OpDispatchBuilder::RDRANDOp},
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_9, PF_66, 6), 1, &OpDispatchBuilder::RDRANDOp},
 
     // GROUP 12
     {OPD(FEXCore::X86Tables::TYPE_GROUP_12, PF_NONE, 2), 1, &OpDispatchBuilder::PSRLI<2>},
@@ -5397,23 +5777,67 @@ constexpr uint16_t PF_F2 = 3;
     {OPD(FEXCore::X86Tables::TYPE_GROUP_15, PF_F3, 5), 1, &OpDispatchBuilder::UnimplementedOp},
     {OPD(FEXCore::X86Tables::TYPE_GROUP_15, PF_F3, 6), 1, &OpDispatchBuilder::UnimplementedOp},
 
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_15, PF_66, 6), 1, &OpDispatchBuilder::CLWBOp},
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_15, PF_66, 7), 1, &OpDispatchBuilder::CLFlushOptOp},
+
     // GROUP 16
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_NONE, 0), 8, &OpDispatchBuilder::NOPOp},
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F3, 0), 8, &OpDispatchBuilder::NOPOp},
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_66, 0), 8, &OpDispatchBuilder::NOPOp},
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F2, 0), 8, &OpDispatchBuilder::NOPOp},
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_NONE, 0), 1, &OpDispatchBuilder::PrefetchOp<false, true, 1>},  // PREFETCHNTA
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_NONE, 1), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCHT0
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_NONE, 2), 1, &OpDispatchBuilder::PrefetchOp<false, false, 2>}, // PREFETCHT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_NONE, 3), 1, &OpDispatchBuilder::PrefetchOp<false, false, 3>}, // PREFETCHT2
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_NONE, 4), 4, &OpDispatchBuilder::NOPOp},
+
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F3, 0), 1, &OpDispatchBuilder::PrefetchOp<false, true, 1>},  // PREFETCHNTA
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F3, 1), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCHT0
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F3, 2), 1, &OpDispatchBuilder::PrefetchOp<false, false, 2>}, // PREFETCHT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F3, 3), 1, &OpDispatchBuilder::PrefetchOp<false, false, 3>}, // PREFETCHT2
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F3, 4), 4, &OpDispatchBuilder::NOPOp},
+
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_66, 0), 1, &OpDispatchBuilder::PrefetchOp<false, true, 1>},  // PREFETCHNTA
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_66, 1), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCHT0
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_66, 2), 1, &OpDispatchBuilder::PrefetchOp<false, false, 2>}, // PREFETCHT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_66, 3), 1, &OpDispatchBuilder::PrefetchOp<false, false, 3>}, // PREFETCHT2
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_66, 4), 4, &OpDispatchBuilder::NOPOp},
+
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F2, 0), 1, &OpDispatchBuilder::PrefetchOp<false, true, 1>},  // PREFETCHNTA
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F2, 1), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCHT0
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F2, 2), 1, &OpDispatchBuilder::PrefetchOp<false, false, 2>}, // PREFETCHT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F2, 3), 1, &OpDispatchBuilder::PrefetchOp<false, false, 3>}, // PREFETCHT2
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_16, PF_F2, 4), 4, &OpDispatchBuilder::NOPOp},
 
     // GROUP P
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_NONE, 0), 8, &OpDispatchBuilder::NOPOp},
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F3, 0), 8, &OpDispatchBuilder::NOPOp},
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_66, 0), 8, &OpDispatchBuilder::NOPOp},
-    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F2, 0), 8, &OpDispatchBuilder::NOPOp},
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_NONE, 0), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCH
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_NONE, 1), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_NONE, 2), 1, &OpDispatchBuilder::PrefetchOp<true, false, 2>},  // PREFETCHWT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_NONE, 3), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // AMD's alias of PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_NONE, 4), 4, &OpDispatchBuilder::PrefetchOp<false, false, 1>},
+
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F3, 0), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCH
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F3, 1), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F3, 2), 1, &OpDispatchBuilder::PrefetchOp<true, false, 2>},  // PREFETCHWT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F3, 3), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // AMD's alias of PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F3, 4), 4, &OpDispatchBuilder::PrefetchOp<false, false, 1>},
+
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_66, 0), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCH
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_66, 1), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_66, 2), 1, &OpDispatchBuilder::PrefetchOp<true, false, 2>},  // PREFETCHWT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_66, 3), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // AMD's alias of PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_66, 4), 4, &OpDispatchBuilder::PrefetchOp<false, false, 1>},
+
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F2, 0), 1, &OpDispatchBuilder::PrefetchOp<false, false, 1>}, // PREFETCH
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F2, 1), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F2, 2), 1, &OpDispatchBuilder::PrefetchOp<true, false, 2>},  // PREFETCHWT1
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F2, 3), 1, &OpDispatchBuilder::PrefetchOp<true, false, 1>},  // AMD's alias of PREFETCHW
+    {OPD(FEXCore::X86Tables::TYPE_GROUP_P, PF_F2, 4), 4, &OpDispatchBuilder::PrefetchOp<false, false, 1>},
   };
 #undef OPD
 
   const std::vector<std::tuple<uint8_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr>> SecondaryModRMExtensionOpTable = {
     // REG /2
     {((1 << 3) | 0), 1, &OpDispatchBuilder::UnimplementedOp},
+
+    // REG /7
+    {((3 << 3) | 1), 1, &OpDispatchBuilder::RDTSCPOp},
   };
 // Top bit indicating if it needs to be repeated with {0x40, 0x80} or'd in
 // All OPDReg versions need it
@@ -5654,6 +6078,7 @@ constexpr uint16_t PF_F2 = 3;
 #define OPD(prefix, opcode) ((prefix << 8) | opcode)
   constexpr uint16_t PF_38_NONE = 0;
   constexpr uint16_t PF_38_66   = 1;
+  constexpr uint16_t PF_38_F2   = 2;
 
   const std::vector<std::tuple<uint16_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr>> H0F38Table = {
     {OPD(PF_38_NONE, 0x00), 1, &OpDispatchBuilder::PSHUFBOp},
@@ -5717,6 +6142,13 @@ constexpr uint16_t PF_F2 = 3;
     {OPD(PF_38_66,   0x40), 1, &OpDispatchBuilder::VectorALUOp<IR::OP_VSMUL, 4>},
     {OPD(PF_38_66,   0x41), 1, &OpDispatchBuilder::PHMINPOSUWOp},
 
+    {OPD(PF_38_NONE, 0xC8), 1, &OpDispatchBuilder::SHA1NEXTEOp},
+    {OPD(PF_38_NONE, 0xC9), 1, &OpDispatchBuilder::SHA1MSG1Op},
+    {OPD(PF_38_NONE, 0xCA), 1, &OpDispatchBuilder::SHA1MSG2Op},
+    {OPD(PF_38_NONE, 0xCB), 1, &OpDispatchBuilder::SHA256RNDS2Op},
+    {OPD(PF_38_NONE, 0xCC), 1, &OpDispatchBuilder::SHA256MSG1Op},
+    {OPD(PF_38_NONE, 0xCD), 1, &OpDispatchBuilder::SHA256MSG2Op},
+
     {OPD(PF_38_66, 0xDB), 1, &OpDispatchBuilder::AESImcOp},
     {OPD(PF_38_66, 0xDC), 1, &OpDispatchBuilder::AESEncOp},
     {OPD(PF_38_66, 0xDD), 1, &OpDispatchBuilder::AESEncLastOp},
@@ -5726,6 +6158,8 @@ constexpr uint16_t PF_F2 = 3;
     {OPD(PF_38_NONE, 0xF0), 2, &OpDispatchBuilder::MOVBEOp},
     {OPD(PF_38_66, 0xF0), 2, &OpDispatchBuilder::MOVBEOp},
 
+    {OPD(PF_38_F2, 0xF0), 2, &OpDispatchBuilder::CRC32Op},
+
   };
 #undef OPD
 
@@ -5758,6 +6192,9 @@ constexpr uint16_t PF_F2 = 3;
     {OPD(0, PF_3A_66,   0x40), 1, &OpDispatchBuilder::DPPOp<4>},
     {OPD(0, PF_3A_66,   0x41), 1, &OpDispatchBuilder::DPPOp<8>},
     {OPD(0, PF_3A_66,   0x42), 1, &OpDispatchBuilder::MPSADBWOp},
+    {OPD(0, PF_3A_66,   0x44), 1, &OpDispatchBuilder::PCLMULQDQOp},
+
+    {OPD(0, PF_3A_NONE, 0xCC), 1, &OpDispatchBuilder::SHA1RNDS4Op},
 
     {OPD(0, PF_3A_66,   0xDF), 1, &OpDispatchBuilder::AESKeyGenAssist},
   };
@@ -11,9 +11,11 @@
 
 #include <FEXCore/Utils/LogManager.h>
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <optional>
 #include <set>
 
 namespace FEXCore::IR {
@@ -68,6 +70,9 @@ public:
 
   void StartNewBlock() {
     flagsOp = FLAGS_OP_NONE;
+    InvalidateSegmentBaseCache();
+    CachedFCWBlock = nullptr;
+    CachedShuffleIndicesBlock = nullptr;
   }
 
   bool FinishOp(uint64_t NextRIP, bool LastOp) {
@@ -101,6 +106,17 @@ public:
     return false;
   }
 
+  /**
+   * @brief Leaves the function after the current op, even if more instructions follow
+   */
+  void ExitFunctionAfterOp(uint64_t NextRIP) {
+    if (!BlockSetRIP) {
+      const uint8_t GPRSize = CTX->GetGPRSize();
+      _ExitFunction(_EntrypointOffset(NextRIP - Entry, GPRSize));
+    }
+    BlockSetRIP = false;
+  }
+
   OpDispatchBuilder(FEXCore::Context::Context *ctx);
 
   void ResetWorkingList();
@@ -159,6 +175,7 @@ public:
   void CQOOp(OpcodeArgs);
   void CDQOp(OpcodeArgs);
   void XCHGOp(OpcodeArgs);
+  void PAUSEOp(OpcodeArgs);
   void SAHFOp(OpcodeArgs);
   void LAHFOp(OpcodeArgs);
   template<bool ToSeg>
@@ -214,6 +231,7 @@ public:
   void POPFOp(OpcodeArgs);
 
   void RDTSCOp(OpcodeArgs);
+  void RDTSCPOp(OpcodeArgs);
   void INCOp(OpcodeArgs);
   void DECOp(OpcodeArgs);
   void NEGOp(OpcodeArgs);
@@ -431,6 +449,8 @@ public:
   void PMULHRSW(OpcodeArgs);
 
   void MOVBEOp(OpcodeArgs);
+  void CRC32Op(OpcodeArgs);
+  void RDRANDOp(OpcodeArgs);
   template<size_t ElementSize>
   void HADDP(OpcodeArgs);
   template<size_t ElementSize>
@@ -448,6 +468,11 @@ public:
   void FenceOp(OpcodeArgs);
 
   void StoreFenceOrCLFlush(OpcodeArgs);
+  void CLFlushOptOp(OpcodeArgs);
+  void CLWBOp(OpcodeArgs);
+  template<bool ForStore, bool Stream, uint8_t CacheLevel>
+  void PrefetchOp(OpcodeArgs);
+  void MOVNTOp(OpcodeArgs);
 
   void PSADBW(OpcodeArgs);
 
@@ -457,6 +482,14 @@ public:
   void AESDecOp(OpcodeArgs);
   void AESDecLastOp(OpcodeArgs);
   void AESKeyGenAssist(OpcodeArgs);
+  void PCLMULQDQOp(OpcodeArgs);
+  void SHA1RNDS4Op(OpcodeArgs);
+  void SHA1NEXTEOp(OpcodeArgs);
+  void SHA1MSG1Op(OpcodeArgs);
+  void SHA1MSG2Op(OpcodeArgs);
+  void SHA256RNDS2Op(OpcodeArgs);
+  void SHA256MSG1Op(OpcodeArgs);
+  void SHA256MSG2Op(OpcodeArgs);
 
   template<size_t ElementSize, size_t DstElementSize, bool Signed>
   void ExtendVectorElements(OpcodeArgs);
@@ -491,6 +524,16 @@ private:
   OrderedNode *Current_HeaderNode{};
 
   OrderedNode *AppendSegmentOffset(OrderedNode *Value, uint32_t Flags, uint32_t DefaultPrefix = 0, bool Override = false);
+  OrderedNode *LoadSegmentBase(uint32_t Prefix);
+  OrderedNode *LoadGuestTSC();
+
+  // Segment bases that have already been calculated in the current IR code block, indexed by segment prefix.
+  // Must be invalidated whenever a selector, a segment base or the GDT may have changed.
+  std::array<OrderedNode*, 6> CachedSegmentBase{};
+  OrderedNode *CachedSegmentBlock{};
+  void InvalidateSegmentBaseCache() {
+    CachedSegmentBlock = nullptr;
+  }
 
   OrderedNode *GetDynamicPC(FEXCore::X86Tables::DecodedOp const& Op, int64_t Offset = 0);
   OrderedNode *LoadSource(FEXCore::IR::RegisterClassType Class, FEXCore::X86Tables::DecodedOp const& Op, FEXCore::X86Tables::DecodedOperand const& Operand, uint32_t Flags, int8_t Align, bool LoadData = true, bool ForceLoad = false);
@@ -547,6 +590,18 @@ private:
   void SetX87TopTag(OrderedNode *Value, uint32_t Tag);
   OrderedNode *GetX87FTW(OrderedNode *Value);
   void SetX87Top(OrderedNode *Value);
+  OrderedNode *GetX87FCW();
+  void SetX87FCW(OrderedNode *NewFCW);
+
+  // x87 control word that has been applied to the softfloat state in the current code block
+  // Lets us skip reapplying the rounding and precision state when it can't have changed
+  OrderedNode *CachedFCW{};
+  OrderedNode *CachedFCWBlock{};
+  // F80LoadFCW that applied CachedFCW, removed again if a new control word replaces it before anything used it
+  OrderedNode *CachedFCWApply{};
+
+  bool DecodeGPRAddress(OrderedNode *Addr, uint32_t *Offset, int64_t *Displacement);
+  OrderedNode *ForwardX87FCWStore(OrderedNode *Addr);
 
   bool DestIsLockedMem(FEXCore::X86Tables::DecodedOp Op) const {
     return DestIsMem(Op) && (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_LOCK) != 0;
@@ -559,6 +614,32 @@ private:
   void CreateJumpBlocks(std::vector<FEXCore::Frontend::Decoder::DecodedBlocks> const *Blocks);
   bool BlockSetRIP {false};
 
+  // A `load, compare, PAUSE, branch back` loop polling a single memory location
+  struct SpinLoopInfo {
+    // Instruction doing the memory access
+    FEXCore::X86Tables::DecodedOp Inst;
+    FEXCore::X86Tables::DecodedOperand const *Mem;
+    // Register the polled value was loaded in to, nullptr when the compare reads memory directly
+    FEXCore::X86Tables::DecodedOperand const *Value;
+    uint8_t Size;
+  };
+  std::optional<SpinLoopInfo> FindSpinLoop(FEXCore::X86Tables::DecodedOp Op);
+  std::vector<FEXCore::Frontend::Decoder::DecodedBlocks> const *DecodedFunctionBlocks{};
+
+  OrderedNode *GenerateStringVectorStep(FEXCore::X86Tables::DecodedOp Op, bool IsCompare, bool MatchEqual, OrderedNode *DF, OrderedNode *LoopStart, OrderedNode *ScalarBody);
+
+  /**
+   * @brief Lowers a shuffle with constant indices to the cheapest native permute that matches it
+   *
+   * Indices below the element count pick from Src1, the rest pick from Src2.
+   * Tries identity, dup, rev64, zip, uzp, trn, ext and single element inserts, then a table lookup.
+   */
+  OrderedNode *ShuffleElements(uint8_t Size, uint8_t ElementSize, OrderedNode *Src1, OrderedNode *Src2, std::array<uint8_t, 16> Indices);
+
+  // Table lookup indices already materialized in the current code block, keyed by their bytes
+  std::map<std::pair<uint64_t, uint64_t>, OrderedNode*> CachedShuffleIndices;
+  OrderedNode *CachedShuffleIndicesBlock{};
+
   bool Multiblock{};
   uint64_t Entry;
 
@@ -9,6 +9,9 @@ $end_info$
 
 #include <FEXCore/Core/X86Enums.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace FEXCore::IR {
 #define OpcodeArgs [[maybe_unused]] FEXCore::X86Tables::DecodedOp Op
 
@@ -502,6 +505,166 @@ void OpDispatchBuilder::PSHUFBOp(OpcodeArgs) {
   StoreResult(FPRClass, Op, Res, -1);
 }
 
+OrderedNode *OpDispatchBuilder::ShuffleElements(uint8_t Size, uint8_t ElementSize, OrderedNode *Src1, OrderedNode *Src2, std::array<uint8_t, 16> Indices) {
+  uint8_t NumElements = Size / ElementSize;
+
+  if (Src1 == Src2) {
+    for (uint8_t i = 0; i < NumElements; ++i) {
+      Indices[i] %= NumElements;
+    }
+  }
+
+  auto ElementByElement = [&]() {
+    auto Dest = Src1;
+    for (uint8_t Element = 0; Element < NumElements; ++Element) {
+      if (Indices[Element] != Element) {
+        Dest = _VInsElement(Size, ElementSize, Element, Indices[Element] % NumElements, Dest, Indices[Element] < NumElements ? Src1 : Src2);
+      }
+    }
+    return Dest;
+  };
+
+  // The native permutes below are all full width
+  if (Size != 16) {
+    return ElementByElement();
+  }
+
+  // Pairs of neighbouring elements that stay together can be shuffled as one larger element
+  while (ElementSize < 8) {
+    bool CanWiden = true;
+    for (uint8_t i = 0; i < NumElements; i += 2) {
+      CanWiden &= (Indices[i] % 2) == 0 && Indices[i + 1] == Indices[i] + 1;
+    }
+
+    if (!CanWiden) {
+      break;
+    }
+
+    for (uint8_t i = 0; i < NumElements / 2; ++i) {
+      Indices[i] = Indices[i * 2] / 2;
+    }
+    ElementSize *= 2;
+    NumElements /= 2;
+  }
+
+  std::array<OrderedNode*, 2> Sources = {Src1, Src2};
+
+  // Each pattern gives the operand (0 or 1) and the element of that operand that ends up in a result element.
+  // Tries every assignment of Src1/Src2 to the two operands and returns the pair that matches
+  auto Match = [&](auto &&Pattern) -> std::optional<std::pair<uint8_t, uint8_t>> {
+    for (uint8_t A = 0; A < 2; ++A) {
+      for (uint8_t B = 0; B < 2; ++B) {
+        bool Matches = true;
+        for (uint8_t i = 0; i < NumElements && Matches; ++i) {
+          auto [Operand, Element] = Pattern(i);
+          Matches = Indices[i] == (Operand ? B : A) * NumElements + Element;
+        }
+
+        if (Matches) {
+          return std::make_pair(A, B);
+        }
+      }
+    }
+    return std::nullopt;
+  };
+
+  using Selection = std::pair<uint8_t, uint8_t>;
+  const uint8_t Half = NumElements / 2;
+
+  if (auto Ops = Match([](uint8_t i) { return Selection{0, i}; })) {
+    return Sources[Ops->first];
+  }
+
+  if (auto Ops = Match([&](uint8_t i) { return Selection{0, Indices[0] % NumElements}; })) {
+    return _VDupElement(Size, ElementSize, Sources[Ops->first], Indices[0] % NumElements);
+  }
+
+  if (ElementSize < 8) {
+    const uint8_t PerChunk = 8 / ElementSize;
+    if (auto Ops = Match([&](uint8_t i) { return Selection{0, i ^ (PerChunk - 1)}; })) {
+      return _VRev64(Size, ElementSize, Sources[Ops->first]);
+    }
+  }
+
+  if (auto Ops = Match([](uint8_t i) { return Selection{i & 1, i / 2}; })) {
+    return _VZip(Size, ElementSize, Sources[Ops->first], Sources[Ops->second]);
+  }
+
+  if (auto Ops = Match([&](uint8_t i) { return Selection{i & 1, Half + i / 2}; })) {
+    return _VZip2(Size, ElementSize, Sources[Ops->first], Sources[Ops->second]);
+  }
+
+  if (auto Ops = Match([&](uint8_t i) { return Selection{i >= Half, (i % Half) * 2}; })) {
+    return _VUnZip(Size, ElementSize, Sources[Ops->first], Sources[Ops->second]);
+  }
+
+  if (auto Ops = Match([&](uint8_t i) { return Selection{i >= Half, (i % Half) * 2 + 1}; })) {
+    return _VUnZip2(Size, ElementSize, Sources[Ops->first], Sources[Ops->second]);
+  }
+
+  if (auto Ops = Match([](uint8_t i) { return Selection{i & 1, i & ~1}; })) {
+    return _VTrn(Size, ElementSize, Sources[Ops->first], Sources[Ops->second]);
+  }
+
+  if (auto Ops = Match([](uint8_t i) { return Selection{i & 1, (i & ~1) + 1}; })) {
+    return _VTrn2(Size, ElementSize, Sources[Ops->first], Sources[Ops->second]);
+  }
+
+  for (uint8_t Shift = 1; Shift < NumElements; ++Shift) {
+    if (auto Ops = Match([&](uint8_t i) { return Selection{i + Shift >= NumElements, (i + Shift) % NumElements}; })) {
+      return _VExtr(Size, 1, Sources[Ops->second], Sources[Ops->first], Shift * ElementSize);
+    }
+  }
+
+  // Everything but one element stays where it is
+  for (uint8_t A = 0; A < 2; ++A) {
+    uint8_t Mismatches{};
+    uint8_t Lane{};
+    for (uint8_t i = 0; i < NumElements; ++i) {
+      if (Indices[i] != A * NumElements + i) {
+        ++Mismatches;
+        Lane = i;
+      }
+    }
+
+    if (Mismatches == 1) {
+      return _VInsElement(Size, ElementSize, Lane, Indices[Lane] % NumElements, Sources[A], Indices[Lane] < NumElements ? Src1 : Src2);
+    }
+  }
+
+  // Anything else from a single source is a table lookup
+  bool FromSrc1 = std::all_of(Indices.begin(), Indices.begin() + NumElements, [&](uint8_t Index) { return Index < NumElements; });
+  bool FromSrc2 = std::all_of(Indices.begin(), Indices.begin() + NumElements, [&](uint8_t Index) { return Index >= NumElements; });
+  if (!FromSrc1 && !FromSrc2) {
+    return ElementByElement();
+  }
+
+  std::array<uint8_t, 16> ByteIndices;
+  for (uint8_t i = 0; i < NumElements; ++i) {
+    for (uint8_t Byte = 0; Byte < ElementSize; ++Byte) {
+      ByteIndices[i * ElementSize + Byte] = (Indices[i] % NumElements) * ElementSize + Byte;
+    }
+  }
+
+  std::pair<uint64_t, uint64_t> Key;
+  memcpy(&Key.first, &ByteIndices[0], sizeof(uint64_t));
+  memcpy(&Key.second, &ByteIndices[8], sizeof(uint64_t));
+
+  // The same shuffles tend to show up over and over in a block, only build each index vector once
+  if (CachedShuffleIndicesBlock != GetCurrentBlock()) {
+    CachedShuffleIndices.clear();
+    CachedShuffleIndicesBlock = GetCurrentBlock();
+  }
+
+  auto &IndexVector = CachedShuffleIndices[Key];
+  if (!IndexVector) {
+    IndexVector = _VCastFromGPR(16, 8, _Constant(Key.first));
+    IndexVector = _VInsGPR(16, 8, IndexVector, _Constant(Key.second), 1);
+  }
+
+  return _VTBL1(Size, FromSrc1 ? Src1 : Src2, IndexVector);
+}
+
 template<size_t ElementSize, bool HalfSize, bool Low>
 void OpDispatchBuilder::PSHUFDOp(OpcodeArgs) {
   LOGMAN_THROW_A(ElementSize != 0, "What. No element size?");
@@ -511,6 +674,11 @@ void OpDispatchBuilder::PSHUFDOp(OpcodeArgs) {
 
   uint8_t NumElements = Size / ElementSize;
 
+  std::array<uint8_t, 16> Indices{};
+  for (uint8_t Element = 0; Element < NumElements; ++Element) {
+    Indices[Element] = Element;
+  }
+
   // 16bit is a bit special of a shuffle
   // It only ever operates on half the register
   // Then there is a high and low variant of the instruction to determine where the destination goes
@@ -521,12 +689,12 @@ void OpDispatchBuilder::PSHUFDOp(OpcodeArgs) {
 
   uint8_t BaseElement = Low ? 0 : NumElements;
 
-  auto Dest = Src;
   for (uint8_t Element = 0; Element < NumElements; ++Element) {
-    Dest = _VInsElement(Size, ElementSize, BaseElement + Element, BaseElement + (Shuffle & 0b11), Dest, Src);
+    Indices[BaseElement + Element] = BaseElement + (Shuffle & 0b11);
     Shuffle >>= 2;
   }
 
+  auto Dest = ShuffleElements(Size, ElementSize, Src, Src, Indices);
   StoreResult(FPRClass, Op, Dest, -1);
 }
 
@@ -549,18 +717,6 @@ void OpDispatchBuilder::SHUFOp(OpcodeArgs) {
 
   uint8_t NumElements = Size / ElementSize;
 
-  auto Dest = Src1;
-  std::array<OrderedNode*, 4> Srcs = {
-  };
-
-  for (int i = 0; i < (NumElements >> 1); ++i) {
-    Srcs[i] = Src1;
-  }
-
-  for (int i = (NumElements >> 1); i < NumElements; ++i) {
-    Srcs[i] = Src2;
-  }
-
   // 32bit:
   // [31:0]   = Src1[Selection]
   // [63:32]  = Src1[Selection]
@@ -571,11 +727,14 @@ void OpDispatchBuilder::SHUFOp(OpcodeArgs) {
   // [127:64] = Src2[Selection]
   uint8_t SelectionMask = NumElements - 1;
   uint8_t ShiftAmount = std::popcount(SelectionMask);
+  std::array<uint8_t, 16> Indices{};
   for (uint8_t Element = 0; Element < NumElements; ++Element) {
-    Dest = _VInsElement(Size, ElementSize, Element, Shuffle & SelectionMask, Dest, Srcs[Element]);
+    uint8_t SourceBase = Element < (NumElements >> 1) ? 0 : NumElements;
+    Indices[Element] = SourceBase + (Shuffle & SelectionMask);
     Shuffle >>= ShiftAmount;
   }
 
+  auto Dest = ShuffleElements(Size, ElementSize, Src1, Src2, Indices);
   StoreResult(FPRClass, Op, Dest, -1);
 }
 
@@ -1255,7 +1414,7 @@ void OpDispatchBuilder::FXSaveOp(OpcodeArgs) {
   }
 
   {
-    auto FCW = _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+    auto FCW = GetX87FCW();
     _StoreMem(GPRClass, 2, Mem, FCW, 2);
   }
 
@@ -1341,8 +1500,7 @@ void OpDispatchBuilder::FXRStoreOp(OpcodeArgs) {
   Mem = AppendSegmentOffset(Mem, Op->Flags);
 
   auto NewFCW = _LoadMem(GPRClass, 2, Mem, 2);
-  _F80LoadFCW(NewFCW);
-  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), NewFCW);
+  SetX87FCW(NewFCW);
 
   {
     OrderedNode *MemLocation = _Add(Mem, _Constant(2));
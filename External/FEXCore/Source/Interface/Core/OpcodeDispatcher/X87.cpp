@@ -9,6 +9,9 @@ $end_info$
 
 #include <FEXCore/Core/X86Enums.h>
 
+#include <algorithm>
+#include <array>
+
 namespace FEXCore::IR {
 #define OpcodeArgs [[maybe_unused]] FEXCore::X86Tables::DecodedOp Op
 
@@ -47,6 +50,220 @@ void OpDispatchBuilder::SetX87Top(OrderedNode *Value) {
   _StoreContext(GPRClass, 1, offsetof(FEXCore::Core::CPUState, flags) + FEXCore::X86State::X87FLAG_TOP_LOC, Value);
 }
 
+OrderedNode *OpDispatchBuilder::GetX87FCW() {
+  if (CachedFCWBlock == GetCurrentBlock()) {
+    return CachedFCW;
+  }
+
+  return _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+}
+
+// Ops that depend on the softfloat rounding and precision state that F80LoadFCW sets up
+static bool ReadsX87ControlWord(IR::IROps Op) {
+  switch (Op) {
+    case IR::OP_F80ADD:
+    case IR::OP_F80SUB:
+    case IR::OP_F80MUL:
+    case IR::OP_F80DIV:
+    case IR::OP_F80SQRT:
+    case IR::OP_F80ROUND:
+    case IR::OP_F80SCALE:
+    case IR::OP_F80FPREM:
+    case IR::OP_F80FPREM1:
+    case IR::OP_F80FYL2X:
+    case IR::OP_F80ATAN:
+    case IR::OP_F80F2XM1:
+    case IR::OP_F80TAN:
+    case IR::OP_F80SIN:
+    case IR::OP_F80COS:
+    case IR::OP_F80XTRACT_EXP:
+    case IR::OP_F80XTRACT_SIG:
+    case IR::OP_F80CMP:
+    case IR::OP_F80CVT:
+    case IR::OP_F80CVTINT:
+    case IR::OP_F80CVTTO:
+    case IR::OP_F80CVTTOINT:
+    case IR::OP_F80BCDLOAD:
+    case IR::OP_F80BCDSTORE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Side effects that can't observe the softfloat state or change guest memory behind our back
+static bool IsPlainStore(IR::IROps Op) {
+  switch (Op) {
+    case IR::OP_STORECONTEXT:
+    case IR::OP_STORECONTEXTINDEXED:
+    case IR::OP_STOREFLAG:
+    case IR::OP_STOREMEM:
+    case IR::OP_STOREMEMTSO:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void OpDispatchBuilder::SetX87FCW(OrderedNode *NewFCW) {
+  // The FCW is only ever changed through FLDCW, FNINIT, FLDENV, FRSTOR and FXRSTOR
+  // If this block already applied the same control word then the softfloat state is still valid
+  if (CachedFCWBlock == GetCurrentBlock()) {
+    uint64_t OldValue, NewValue;
+    if (CachedFCW == NewFCW ||
+        (IsValueConstant(WrapNode(CachedFCW), &OldValue) &&
+         IsValueConstant(WrapNode(NewFCW), &NewValue) &&
+         (OldValue & 0xFFFF) == (NewValue & 0xFFFF))) {
+      return;
+    }
+
+    // If nothing since the last F80LoadFCW used the softfloat state or could leave the block, applying it was wasted.
+    // This is what makes `fldcw [m2]; fistp; fldcw [m]` cheap in loops, only the restore before the next fldcw [m2] is dropped
+    bool Observed = false;
+    auto Cursor = GetWriteCursor();
+    for (auto Node = UnwrapNode(CachedFCWApply->Header.Next); ; Node = UnwrapNode(Node->Header.Next)) {
+      auto Op = GetOpHeader(WrapNode(Node))->Op;
+      if (ReadsX87ControlWord(Op) ||
+          (IR::HasSideEffects(Op) && !IsPlainStore(Op))) {
+        Observed = true;
+        break;
+      }
+
+      if (Node == Cursor || Node->Header.Next.IsInvalid()) {
+        break;
+      }
+    }
+
+    if (!Observed) {
+      Remove(CachedFCWApply);
+    }
+  }
+
+  CachedFCWApply = _F80LoadFCW(NewFCW);
+  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), NewFCW);
+
+  CachedFCW = NewFCW;
+  CachedFCWBlock = GetCurrentBlock();
+}
+
+// Decodes an address of the form GPR + displacement, which is what stack and struct accesses end up as
+bool OpDispatchBuilder::DecodeGPRAddress(OrderedNode *Addr, uint32_t *Offset, int64_t *Displacement) {
+  auto Header = GetOpHeader(WrapNode(Addr));
+  *Displacement = 0;
+
+  if (Header->Op == IR::OP_ADD) {
+    uint64_t Constant;
+    if (!IsValueConstant(Header->Args[1], &Constant)) {
+      return false;
+    }
+
+    *Displacement = static_cast<int64_t>(Constant);
+    Header = GetOpHeader(Header->Args[0]);
+  }
+
+  if (Header->Op != IR::OP_LOADCONTEXT || Header->Size != CTX->GetGPRSize()) {
+    return false;
+  }
+
+  *Offset = Header->C<IR::IROp_LoadContext>()->Offset;
+  return *Offset >= offsetof(FEXCore::Core::CPUState, gregs[0]) &&
+         *Offset <= offsetof(FEXCore::Core::CPUState, gregs[15]);
+}
+
+/**
+ * @brief Finds the value a guest store in this block left at the control word an FLDCW is about to load
+ *
+ * Compilers save the control word once with FNSTCW and build the truncating one next to it,
+ * then every float to int conversion is `fldcw [m2]; fistp; fldcw [m]`.
+ * Forwarding both stores gives FLDCW the same nodes each time, so SetX87FCW can see the control word didn't change.
+ *
+ * Only stores through the same unmodified base register are looked through, anything else could alias.
+ *
+ * @return The stored value, or nullptr if it has to be loaded from memory
+ */
+OrderedNode *OpDispatchBuilder::ForwardX87FCWStore(OrderedNode *Addr) {
+  // Bounds the cost of the walk on long blocks, saved control words are close to their use
+  constexpr size_t MaxScan = 256;
+
+  uint32_t BaseOffset;
+  int64_t Displacement;
+  if (!DecodeGPRAddress(Addr, &BaseOffset, &Displacement)) {
+    return nullptr;
+  }
+
+  const auto GPRSize = CTX->GetGPRSize();
+  auto ClobbersBase = [&](IR::IROp_Header *Header) {
+    auto Op = Header->C<IR::IROp_StoreContext>();
+    return Op->Offset < (BaseOffset + GPRSize) && BaseOffset < (Op->Offset + Header->Size);
+  };
+
+  // Every store looked at has to have computed its address from the same base register value as ours
+  // So once the value is found the walk carries on until it has passed all of their base register loads
+  constexpr size_t MaxBases = 8;
+  std::array<OrderedNode*, MaxBases> PendingBases{};
+  size_t NumPendingBases = 0;
+  OrderedNode *Forwarded{};
+
+  auto Node = GetWriteCursor();
+  for (size_t i = 0; i < MaxScan; ++i) {
+    auto Header = GetOpHeader(WrapNode(Node));
+    auto Op = Header->Op;
+
+    if (Op == IR::OP_BEGINBLOCK || Op == IR::OP_CODEBLOCK) {
+      return nullptr;
+    }
+
+    if (Op == IR::OP_STORECONTEXT) {
+      if (ClobbersBase(Header)) {
+        return nullptr;
+      }
+    }
+    else if (Op == IR::OP_LOADCONTEXT) {
+      auto End = std::remove(PendingBases.begin(), PendingBases.begin() + NumPendingBases, Node);
+      NumPendingBases = End - PendingBases.begin();
+    }
+    else if ((Op == IR::OP_STOREMEM || Op == IR::OP_STOREMEMTSO) && !Forwarded) {
+      auto Store = Header->C<IR::IROp_StoreMem>();
+      uint32_t StoreBase;
+      int64_t StoreDisplacement;
+      if (!Store->Offset.IsInvalid() ||
+          !DecodeGPRAddress(UnwrapNode(Store->Addr), &StoreBase, &StoreDisplacement) ||
+          StoreBase != BaseOffset ||
+          NumPendingBases == MaxBases) {
+        return nullptr;
+      }
+
+      auto AddrHeader = GetOpHeader(Store->Addr);
+      PendingBases[NumPendingBases++] = UnwrapNode(AddrHeader->Op == IR::OP_ADD ? AddrHeader->Args[0] : Store->Addr);
+
+      if (StoreDisplacement == Displacement && Store->Size == 2) {
+        // Narrow values only, a wider node would leak its upper bits through FNSTENV
+        if (GetOpSize(UnwrapNode(Store->Value)) > 2) {
+          return nullptr;
+        }
+        Forwarded = UnwrapNode(Store->Value);
+      }
+      else if (StoreDisplacement < (Displacement + 2) && Displacement < (StoreDisplacement + Store->Size)) {
+        return nullptr;
+      }
+    }
+    else if (!Forwarded && IR::HasSideEffects(Op) && !IsPlainStore(Op) && Op != IR::OP_F80LOADFCW) {
+      return nullptr;
+    }
+
+    if (Forwarded && NumPendingBases == 0) {
+      return Forwarded;
+    }
+
+    if (Node->Header.Previous.IsInvalid()) {
+      return nullptr;
+    }
+    Node = UnwrapNode(Node->Header.Previous);
+  }
+
+  return nullptr;
+}
+
 template<size_t width>
 void OpDispatchBuilder::FLD(OpcodeArgs) {
   // Update TOP
@@ -615,8 +832,7 @@ void OpDispatchBuilder::FXTRACT(OpcodeArgs) {
 void OpDispatchBuilder::FNINIT(OpcodeArgs) {
   // Init FCW to 0x037
   auto NewFCW = _Constant(16, 0x037);
-  _F80LoadFCW(NewFCW);
-  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), NewFCW);
+  SetX87FCW(NewFCW);
 
   // Init FSW to 0
   SetX87Top(_Constant(0));
@@ -916,8 +1132,7 @@ void OpDispatchBuilder::X87LDENV(OpcodeArgs) {
   Mem = AppendSegmentOffset(Mem, Op->Flags);
 
   auto NewFCW = _LoadMem(GPRClass, 2, Mem, 2);
-  _F80LoadFCW(NewFCW);
-  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), NewFCW);
+  SetX87FCW(NewFCW);
 
   OrderedNode *MemLocation = _Add(Mem, _Constant(Size * 1));
   auto NewFSW = _LoadMem(GPRClass, Size, MemLocation, Size);
@@ -969,7 +1184,7 @@ void OpDispatchBuilder::X87FNSTENV(OpcodeArgs) {
   Mem = AppendSegmentOffset(Mem, Op->Flags);
 
   {
-    auto FCW = _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+    auto FCW = GetX87FCW();
     _StoreMem(GPRClass, Size, Mem, FCW, Size);
   }
 
@@ -1027,13 +1242,20 @@ void OpDispatchBuilder::X87FNSTENV(OpcodeArgs) {
 }
 
 void OpDispatchBuilder::X87FLDCW(OpcodeArgs) {
-  OrderedNode *NewFCW = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-  _F80LoadFCW(NewFCW);
-  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), NewFCW);
+  OrderedNode *NewFCW{};
+  if (!Op->Src[0].IsGPR()) {
+    OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
+    NewFCW = ForwardX87FCWStore(AppendSegmentOffset(Mem, Op->Flags));
+  }
+
+  if (!NewFCW) {
+    NewFCW = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+  }
+  SetX87FCW(NewFCW);
 }
 
 void OpDispatchBuilder::X87FSTCW(OpcodeArgs) {
-  auto FCW = _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+  auto FCW = GetX87FCW();
 
   StoreResult(GPRClass, Op, FCW, -1);
 }
@@ -1100,7 +1322,7 @@ void OpDispatchBuilder::X87FNSAVE(OpcodeArgs) {
 
   OrderedNode *Top = GetX87Top();
   {
-    auto FCW = _LoadContext(2, offsetof(FEXCore::Core::CPUState, FCW), GPRClass);
+    auto FCW = GetX87FCW();
     _StoreMem(GPRClass, Size, Mem, FCW, Size);
   }
 
@@ -1187,8 +1409,7 @@ void OpDispatchBuilder::X87FRSTOR(OpcodeArgs) {
   Mem = AppendSegmentOffset(Mem, Op->Flags);
 
   auto NewFCW = _LoadMem(GPRClass, 2, Mem, 2);
-  _F80LoadFCW(NewFCW);
-  _StoreContext(GPRClass, 2, offsetof(FEXCore::Core::CPUState, FCW), NewFCW);
+  SetX87FCW(NewFCW);
 
   OrderedNode *MemLocation = _Add(Mem, _Constant(Size * 1));
   auto NewFSW = _LoadMem(GPRClass, Size, MemLocation, Size);
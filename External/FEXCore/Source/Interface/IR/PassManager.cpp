@@ -14,7 +14,7 @@ $end_info$
 
 namespace FEXCore::IR {
 
-void PassManager::AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllocation) {
+void PassManager::AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllocation, bool SupportsTSOImm9) {
   FEX_CONFIG_OPT(DisablePasses, O0);
 
   if (!DisablePasses()) {
@@ -26,18 +26,31 @@ void PassManager::AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllo
       InsertPass(CreateLongDivideEliminationPass());
     }
 
+    // This needs to run after long divide elimination so it sees the plain 64bit divides
+    InsertPass(CreateDivisionByConstantPass());
+
     InsertPass(CreateDeadStoreElimination());
     InsertPass(CreatePassDeadCodeElimination());
-    InsertPass(CreateConstProp(InlineConstants));
+    InsertPass(CreateConstProp(InlineConstants, SupportsTSOImm9));
 
     ////// InsertPass(CreateDeadFlagCalculationEliminination());
 
     InsertPass(CreateSyscallOptimization());
     InsertPass(CreatePassDeadCodeElimination());
 
+    // Sink the cold slow path blocks out of the way of the hot path
+    InsertPass(CreateBlockLayoutPass());
+
     // only do SRA if enabled and JIT
     if (InlineConstants && StaticRegisterAllocation)
       InsertPass(CreateStaticRegisterAllocationPass());
+
+#ifdef _M_ARM_64
+    // In-order Arm64 cores can't hide load latency themselves
+    // Needs to run after SRA so the static register loads get scheduled as well
+    if (InlineConstants)
+      InsertPass(CreateInstructionScheduling());
+#endif
   }
   else {
     // only do SRA if enabled and JIT
@@ -14,6 +14,10 @@ $end_info$
 #include <memory>
 #include <vector>
 
+namespace FEXCore {
+class CPUIDEmu;
+}
+
 namespace FEXCore::HLE {
 class SyscallHandler;
 }
@@ -21,6 +25,7 @@ class SyscallHandler;
 namespace FEXCore::IR {
 class OpDispatchBuilder;
 class SyscallOptimization;
+class ConstProp;
 
 using ShouldExitHandler = std::function<void(void)>;
 
@@ -39,8 +44,9 @@ protected:
 
 class PassManager final {
   friend class SyscallOptimization;
+  friend class ConstProp;
 public:
-  void AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllocation);
+  void AddDefaultPasses(bool InlineConstants, bool StaticRegisterAllocation, bool SupportsTSOImm9);
   void AddDefaultValidationPasses();
   Pass* InsertPass(std::unique_ptr<Pass> Pass) {
     Pass->RegisterPassManager(this);
@@ -67,9 +73,14 @@ public:
     SyscallHandler = Handler;
   }
 
+  void RegisterCPUIDHandler(FEXCore::CPUIDEmu *Handler) {
+    CPUIDHandler = Handler;
+  }
+
 protected:
   ShouldExitHandler ExitHandler;
   FEXCore::HLE::SyscallHandler *SyscallHandler;
+  FEXCore::CPUIDEmu *CPUIDHandler{};
 
 private:
   Pass *RAPass{};
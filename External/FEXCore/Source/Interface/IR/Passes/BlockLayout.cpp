@@ -0,0 +1,96 @@
+/*
+$info$
+tags: ir|opts
+desc: Sinks cold code blocks to the end of the block list so the hot path is laid out contiguously
+$end_info$
+*/
+
+#include "Interface/IR/PassManager.h"
+
+#include <FEXCore/IR/IR.h>
+
+#include <vector>
+
+namespace FEXCore::IR {
+
+class BlockLayout final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+};
+
+/**
+ * @brief Moves blocks that are known to be cold behind all of the hot blocks
+ *
+ * A block is cold if it leaves the JIT through a slow path and never falls through to another block:
+ * - Guest breakpoints and faults that end in a Break
+ * - SMC validation failures that remove the code entry before exiting
+ *
+ * The backends emit blocks in list order and elide a branch to the block that directly follows,
+ * so with the cold blocks out of the way the hot blocks end up falling through to one another.
+ */
+bool BlockLayout::Run(IREmitter *IREmit) {
+  auto CurrentIR = IREmit->ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+
+  std::vector<OrderedNode*> HotBlocks;
+  std::vector<OrderedNode*> ColdBlocks;
+  OrderedNode *Tail{};
+  bool SeenCold = false;
+  bool Changed = false;
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    Tail = BlockNode;
+    bool HasColdOp = false;
+    IROps LastOp = OP_DUMMY;
+
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      if (IROp->Op == OP_BREAK || IROp->Op == OP_REMOVECODEENTRY) {
+        HasColdOp = true;
+      }
+
+      if (IROp->Op != OP_ENDBLOCK) {
+        LastOp = IROp->Op;
+      }
+    }
+
+    // The entry block must stay first
+    bool IsCold = !HotBlocks.empty() &&
+                  HasColdOp &&
+                  (LastOp == OP_BREAK || LastOp == OP_EXITFUNCTION);
+
+    if (IsCold) {
+      ColdBlocks.emplace_back(BlockNode);
+      SeenCold = true;
+    }
+    else {
+      HotBlocks.emplace_back(BlockNode);
+      // A hot block after a cold one means the layout needs to change
+      Changed |= SeenCold;
+    }
+  }
+
+  if (!Changed) {
+    return false;
+  }
+
+  // Relink the block list as hot blocks followed by cold blocks
+  // The list terminators are kept as is, and the entry block is unchanged so the IR header stays valid
+  auto FirstPrevious = HotBlocks.front()->Header.Previous;
+  auto LastNext = Tail->Header.Next;
+
+  HotBlocks.insert(HotBlocks.end(), ColdBlocks.begin(), ColdBlocks.end());
+
+  for (size_t i = 0; i < HotBlocks.size(); ++i) {
+    auto Block = HotBlocks[i];
+    Block->Header.Previous = i == 0 ? FirstPrevious : HotBlocks[i - 1]->Wrapped(ListBegin);
+    Block->Header.Next = i == (HotBlocks.size() - 1) ? LastNext : HotBlocks[i + 1]->Wrapped(ListBegin);
+  }
+
+  return true;
+}
+
+std::unique_ptr<FEXCore::IR::Pass> CreateBlockLayoutPass() {
+  return std::make_unique<BlockLayout>();
+}
+
+}
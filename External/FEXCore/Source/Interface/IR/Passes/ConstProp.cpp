@@ -15,8 +15,12 @@ $end_info$
 #endif
 
 #include "Interface/IR/PassManager.h"
+#include "Interface/Core/CPUID.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <optional>
+#include <utility>
+
 namespace FEXCore::IR {
 
 template<typename T>
@@ -60,6 +64,11 @@ static bool IsImmMemory(uint64_t imm, uint8_t AccessSize) {
   }
 }
 
+// ldapur/stlur only have an unscaled signed 9bit immediate, there are no register offset forms
+static bool IsImmTSOMemory(uint64_t imm) {
+  return ((int64_t)imm >= -256) && ((int64_t)imm <= 255);
+}
+
 static std::tuple<MemOffsetType, uint8_t, OrderedNode*, OrderedNode*> MemExtendedAddressing(IREmitter *IREmit, uint8_t AccessSize,  IROp_Header* AddressHeader) {
   auto Src0Header = IREmit->GetOpHeader(AddressHeader->Args[0]);
   if (Src0Header->Size == 8) {
@@ -110,10 +119,31 @@ static std::tuple<MemOffsetType, uint8_t, OrderedNode*, OrderedNode*> MemExtende
 #endif
   }
 
+  // Segment relative accesses (eg. %fs:0x28) come through as Constant + SegmentBase
+  // Keep the constant in the offset slot so it can be inlined as an immediate
+  if (IREmit->IsValueConstant(AddressHeader->Args[0]) && !IREmit->IsValueConstant(AddressHeader->Args[1])) {
+    return { MEM_OFFSET_SXTX, 1, IREmit->UnwrapNode(AddressHeader->Args[1]), IREmit->UnwrapNode(AddressHeader->Args[0]) };
+  }
+
   // no match anywhere, just add
   return { MEM_OFFSET_SXTX, 1, IREmit->UnwrapNode(AddressHeader->Args[0]), IREmit->UnwrapNode(AddressHeader->Args[1]) };
 }
 
+// TSO accesses only fold Base + Imm9, the backends fall back to a separate add for anything else
+static std::optional<std::pair<OrderedNode*, OrderedNode*>> MemTSOImmAddressing(IREmitter *IREmit, IROp_Header* AddressHeader) {
+  uint64_t Constant;
+  if (IREmit->IsValueConstant(AddressHeader->Args[1], &Constant) && IsImmTSOMemory(Constant)) {
+    return std::make_pair(IREmit->UnwrapNode(AddressHeader->Args[0]), IREmit->UnwrapNode(AddressHeader->Args[1]));
+  }
+
+  // Segment relative accesses come through as Constant + SegmentBase
+  if (IREmit->IsValueConstant(AddressHeader->Args[0], &Constant) && IsImmTSOMemory(Constant)) {
+    return std::make_pair(IREmit->UnwrapNode(AddressHeader->Args[1]), IREmit->UnwrapNode(AddressHeader->Args[0]));
+  }
+
+  return std::nullopt;
+}
+
 static OrderedNodeWrapper RemoveUselessMasking(IREmitter *IREmit, OrderedNodeWrapper src, uint64_t mask) {
   #if 1 // HOTFIX: We need to clear up the meaning of opsize and dest size. See #594
     return src;
@@ -154,11 +184,14 @@ static bool IsBfeAlreadyDone(IREmitter *IREmit, OrderedNodeWrapper src, uint64_t
 
 class ConstProp final : public FEXCore::IR::Pass {
 public:
-  explicit ConstProp(bool DoInlineConstants) : InlineConstants(DoInlineConstants) { }
+  explicit ConstProp(bool DoInlineConstants, bool SupportsTSOImm9)
+    : InlineConstants(DoInlineConstants)
+    , SupportsTSOImm9(SupportsTSOImm9) { }
 
   bool Run(IREmitter *IREmit) override;
 
   bool InlineConstants;
+  bool SupportsTSOImm9;
 
 private:
   bool HandleConstantPools(IREmitter *IREmit, const IRListView& CurrentIR);
@@ -547,6 +580,40 @@ bool ConstProp::ConstantPropagation(IREmitter *IREmit, const IRListView& Current
       break;
     }
 
+    case OP_LOADMEMTSO: {
+      auto Op = IROp->CW<IR::IROp_LoadMemTSO>();
+      auto AddressHeader = IREmit->GetOpHeader(Op->Header.Args[0]);
+
+      if (SupportsTSOImm9 && Op->Offset.IsInvalid() && AddressHeader->Op == OP_ADD && AddressHeader->Size == 8) {
+        if (auto Folded = MemTSOImmAddressing(IREmit, AddressHeader)) {
+          Op->OffsetType = MEM_OFFSET_SXTX;
+          Op->OffsetScale = 1;
+          IREmit->ReplaceNodeArgument(CodeNode, 0, Folded->first);
+          IREmit->ReplaceNodeArgument(CodeNode, 1, Folded->second);
+
+          Changed = true;
+        }
+      }
+      break;
+    }
+
+    case OP_STOREMEMTSO: {
+      auto Op = IROp->CW<IR::IROp_StoreMemTSO>();
+      auto AddressHeader = IREmit->GetOpHeader(Op->Header.Args[0]);
+
+      if (SupportsTSOImm9 && Op->Offset.IsInvalid() && AddressHeader->Op == OP_ADD && AddressHeader->Size == 8) {
+        if (auto Folded = MemTSOImmAddressing(IREmit, AddressHeader)) {
+          Op->OffsetType = MEM_OFFSET_SXTX;
+          Op->OffsetScale = 1;
+          IREmit->ReplaceNodeArgument(CodeNode, 0, Folded->first);
+          IREmit->ReplaceNodeArgument(CodeNode, 2, Folded->second);
+
+          Changed = true;
+        }
+      }
+      break;
+    }
+
     case OP_ADD: {
       auto Op = IROp->C<IR::IROp_Add>();
       uint64_t Constant1{};
@@ -691,6 +758,28 @@ bool ConstProp::ConstantPropagation(IREmitter *IREmit, const IRListView& Current
       }
     break;
     }
+    case OP_EXTRACTELEMENTPAIR: {
+      auto Op = IROp->C<IR::IROp_ExtractElementPair>();
+      auto PairOp = IREmit->GetOpHeader(Op->Header.Args[0]);
+
+      // CPUID results never change once the context is initialized, so a known function can be folded
+      uint64_t Function;
+      uint64_t Leaf{};
+      if (PairOp->Op == OP_CPUID &&
+          Manager->CPUIDHandler &&
+          IREmit->IsValueConstant(PairOp->Args[0], &Function) &&
+          (!Manager->CPUIDHandler->DoesFunctionDependOnLeaf(Function) || IREmit->IsValueConstant(PairOp->Args[1], &Leaf))) {
+        auto Results = Manager->CPUIDHandler->RunFunction(Function, Leaf);
+
+        // Matches the layout of the CPUID op's result pair
+        uint64_t NewConstant = Op->Element == 0 ?
+          (uint64_t(Results.ebx) << 32) | Results.eax :
+          (uint64_t(Results.edx) << 32) | Results.ecx;
+        IREmit->ReplaceWithConstant(CodeNode, NewConstant);
+        Changed = true;
+      }
+    break;
+    }
     case OP_BFE: {
       auto Op = IROp->C<IR::IROp_Bfe>();
       uint64_t Constant;
@@ -956,6 +1045,36 @@ bool ConstProp::ConstantInlining(IREmitter *IREmit, const IRListView& CurrentIR)
         break;
       }
 
+      case OP_LOADMEMTSO:
+      {
+        auto Op = IROp->CW<IR::IROp_LoadMemTSO>();
+
+        uint64_t Constant2{};
+        if (IREmit->IsValueConstant(Op->Header.Args[1], &Constant2) && IsImmTSOMemory(Constant2)) {
+          IREmit->SetWriteCursor(CurrentIR.GetNode(Op->Header.Args[1]));
+
+          IREmit->ReplaceNodeArgument(CodeNode, 1, IREmit->_InlineConstant(Constant2));
+
+          Changed = true;
+        }
+        break;
+      }
+
+      case OP_STOREMEMTSO:
+      {
+        auto Op = IROp->CW<IR::IROp_StoreMemTSO>();
+
+        uint64_t Constant2{};
+        if (IREmit->IsValueConstant(Op->Header.Args[2], &Constant2) && IsImmTSOMemory(Constant2)) {
+          IREmit->SetWriteCursor(CurrentIR.GetNode(Op->Header.Args[2]));
+
+          IREmit->ReplaceNodeArgument(CodeNode, 2, IREmit->_InlineConstant(Constant2));
+
+          Changed = true;
+        }
+        break;
+      }
+
       default:
         break;
     }
@@ -994,8 +1113,8 @@ bool ConstProp::Run(IREmitter *IREmit) {
   return Changed;
 }
 
-std::unique_ptr<FEXCore::IR::Pass> CreateConstProp(bool InlineConstants) {
-  return std::make_unique<ConstProp>(InlineConstants);
+std::unique_ptr<FEXCore::IR::Pass> CreateConstProp(bool InlineConstants, bool SupportsTSOImm9) {
+  return std::make_unique<ConstProp>(InlineConstants, SupportsTSOImm9);
 }
 
 }
@@ -62,7 +62,7 @@ namespace {
     std::vector<ContextMemberInfo> ClassificationInfo;
   };
 
-  constexpr static std::array<LastAccessType, 16> DefaultAccess = {
+  constexpr static std::array<LastAccessType, 18> DefaultAccess = {
     ACCESS_NONE,
     ACCESS_NONE,
     ACCESS_INVALID, // PAD
@@ -79,6 +79,8 @@ namespace {
     ACCESS_NONE,
     ACCESS_NONE,
     ACCESS_NONE,
+    ACCESS_INVALID, // PAD
+    ACCESS_NONE,
   };
 
   static void ClassifyContextStruct(ContextInfo *ContextClassificationInfo) {
@@ -241,6 +243,24 @@ namespace {
       FEXCore::IR::InvalidClass,
     });
 
+    ContextClassification->emplace_back(ContextMemberInfo {
+      ContextMemberClassification {
+        offsetof(FEXCore::Core::CPUState, FTW) + sizeof(FEXCore::Core::CPUState::FTW),
+        sizeof(uint32_t),
+      },
+      DefaultAccess[16], ///< NOP padding
+      FEXCore::IR::InvalidClass,
+    });
+
+    // VirtualTSC
+    ContextClassification->emplace_back(ContextMemberInfo {
+      ContextMemberClassification {
+        offsetof(FEXCore::Core::CPUState, VirtualTSC),
+        sizeof(FEXCore::Core::CPUState::VirtualTSC),
+      },
+      DefaultAccess[17],
+      FEXCore::IR::InvalidClass,
+    });
 
     size_t ClassifiedStructSize{};
     ContextClassificationInfo->Lookup.reserve(sizeof(FEXCore::Core::CPUState));
@@ -0,0 +1,167 @@
+/*
+$info$
+tags: ir|opts
+desc: Replaces unsigned division by a constant with multiply-high and shift sequences
+$end_info$
+*/
+
+#include "Interface/IR/PassManager.h"
+#include <FEXCore/Utils/LogManager.h>
+
+#include <bit>
+
+namespace FEXCore::IR {
+
+class DivisionByConstantPass final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+private:
+  bool IsZeroOp(IREmitter *IREmit, OrderedNodeWrapper Arg);
+  OrderedNode *GenerateQuotient(IREmitter *IREmit, OrderedNode *Dividend, uint8_t Size, uint64_t Divisor);
+};
+
+bool DivisionByConstantPass::IsZeroOp(IREmitter *IREmit, OrderedNodeWrapper Arg) {
+  auto IROp = IREmit->GetOpHeader(Arg);
+  uint64_t Value;
+
+  // XOR based zero
+  if (IROp->Op == OP_XOR) {
+    return IROp->Args[0] == IROp->Args[1];
+  }
+  else if (IREmit->IsValueConstant(Arg, &Value)) {
+    // Zero constant based zero op
+    return Value == 0;
+  }
+  return false;
+}
+
+/**
+ * @brief Generates the quotient of a zero extended dividend and a constant
+ *
+ * 32bit: Lemire's method, umulh(x, ceil(2^64 / d)) is exact for every 32bit x
+ * 64bit: Granlund-Montgomery. Use umulh(x, m) >> s when the magic fits in 64bits,
+ *        otherwise fall back to the round up variant that needs an add fixup
+ */
+OrderedNode *DivisionByConstantPass::GenerateQuotient(IREmitter *IREmit, OrderedNode *Dividend, uint8_t Size, uint64_t Divisor) {
+  if (std::has_single_bit(Divisor)) {
+    auto Shift = std::countr_zero(Divisor);
+    if (Shift == 0) {
+      return Dividend;
+    }
+    return IREmit->_Lshr(Dividend, IREmit->_Constant(Shift));
+  }
+
+  if (Size == 4) {
+    uint64_t Magic = ~0ULL / Divisor + 1;
+    return IREmit->_UMulH(Dividend, IREmit->_Constant(Magic));
+  }
+
+  using uint128_t = unsigned __int128;
+  for (uint32_t Shift = 0; Shift < 64; ++Shift) {
+    uint128_t Pow = uint128_t(1) << (64 + Shift);
+    uint128_t Magic = Pow / Divisor + 1;
+    if (Magic >> 64) {
+      break;
+    }
+
+    // Exact for every 64bit dividend as long as the rounding error of the magic is within 2^Shift
+    if ((Magic * Divisor - Pow) <= (uint128_t(1) << Shift)) {
+      OrderedNode *Result = IREmit->_UMulH(Dividend, IREmit->_Constant(uint64_t(Magic)));
+      if (Shift) {
+        Result = IREmit->_Lshr(Result, IREmit->_Constant(Shift));
+      }
+      return Result;
+    }
+  }
+
+  // t = umulh(x, m)
+  // q = (t + ((x - t) >> 1)) >> (l - 1)
+  uint32_t Log2 = 64 - std::countl_zero(Divisor - 1);
+  uint64_t Magic = ((uint128_t(1) << 64) * ((uint128_t(1) << Log2) - Divisor)) / Divisor + 1;
+
+  OrderedNode *Tmp = IREmit->_UMulH(Dividend, IREmit->_Constant(Magic));
+  OrderedNode *Result = IREmit->_Lshr(IREmit->_Sub(Dividend, Tmp), IREmit->_Constant(1));
+  Result = IREmit->_Add(Result, Tmp);
+  return IREmit->_Lshr(Result, IREmit->_Constant(Log2 - 1));
+}
+
+bool DivisionByConstantPass::Run(IREmitter *IREmit) {
+  bool Changed = false;
+  auto CurrentIR = IREmit->ViewIR();
+  auto OriginalWriteCursor = IREmit->GetWriteCursor();
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      if (IROp->Size != 4 && IROp->Size != 8) {
+        continue;
+      }
+
+      OrderedNodeWrapper Dividend;
+      OrderedNodeWrapper Divisor;
+      bool IsRemainder{};
+
+      if (IROp->Op == OP_UDIV ||
+          IROp->Op == OP_UREM) {
+        Dividend = IROp->Args[0];
+        Divisor = IROp->Args[1];
+        IsRemainder = IROp->Op == OP_UREM;
+      }
+      else if (IROp->Op == OP_LUDIV ||
+               IROp->Op == OP_LUREM) {
+        // Only a zero upper half is guaranteed to never fault, so that's all that can be strength reduced
+        auto Op = IROp->C<IR::IROp_LUDiv>();
+        if (!IsZeroOp(IREmit, Op->Upper)) {
+          continue;
+        }
+        Dividend = Op->Lower;
+        Divisor = Op->Divisor;
+        IsRemainder = IROp->Op == OP_LUREM;
+      }
+      else {
+        continue;
+      }
+
+      uint64_t Constant;
+      if (!IREmit->IsValueConstant(Divisor, &Constant)) {
+        continue;
+      }
+
+      if (IROp->Size == 4) {
+        Constant &= ~0U;
+      }
+
+      // Leave division by zero to fault at runtime
+      if (Constant == 0) {
+        continue;
+      }
+
+      IREmit->SetWriteCursor(CodeNode);
+
+      OrderedNode *Source = CurrentIR.GetNode(Dividend);
+      if (IROp->Size == 4) {
+        Source = IREmit->_Bfe(8, 32, 0, Source);
+      }
+
+      OrderedNode *Result = GenerateQuotient(IREmit, Source, IROp->Size, Constant);
+      if (IsRemainder) {
+        Result = IREmit->_Sub(Source, IREmit->_Mul(Result, IREmit->_Constant(Constant)));
+      }
+
+      if (IROp->Size == 4) {
+        Result = IREmit->_Bfe(4, 32, 0, Result);
+      }
+
+      IREmit->ReplaceAllUsesWith(CodeNode, Result);
+      Changed = true;
+    }
+  }
+
+  IREmit->SetWriteCursor(OriginalWriteCursor);
+
+  return Changed;
+}
+
+std::unique_ptr<FEXCore::IR::Pass> CreateDivisionByConstantPass() {
+  return std::make_unique<DivisionByConstantPass>();
+}
+}
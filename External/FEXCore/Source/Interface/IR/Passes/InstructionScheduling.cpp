@@ -0,0 +1,288 @@
+/*
+$info$
+tags: ir|opts
+desc: List scheduler that interleaves independent work between loads and their uses
+$end_info$
+*/
+
+#include "Interface/IR/PassManager.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/Utils/LogManager.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace FEXCore::IR {
+
+class InstructionScheduling final : public FEXCore::IR::Pass {
+public:
+  bool Run(IREmitter *IREmit) override;
+
+private:
+  // Larger regions only hoist loads further, which increases register pressure without hiding more latency
+  constexpr static size_t MaxRegionSize = 32;
+
+  struct SchedNode {
+    OrderedNode *Node;
+    uint32_t Latency;
+    uint32_t Height;
+    uint32_t Earliest;
+    uint32_t NumPreds;
+    std::vector<uint32_t> Succs;
+  };
+
+  bool ScheduleRegion(IRListView *IR, OrderedNode *RegionEnd);
+
+  std::vector<OrderedNode*> Region;
+  std::vector<SchedNode> Nodes;
+  std::vector<int32_t> IDToIndex;
+};
+
+// Ops that must keep their position relative to everything else in the block
+static bool IsSchedulingBarrier(IROps Op) {
+  if (IR::HasSideEffects(Op)) {
+    return true;
+  }
+
+  switch (Op) {
+    case OP_PHI:
+    case OP_PHIVALUE:
+    case OP_GUESTCALLDIRECT:
+    case OP_GUESTCALLINDIRECT:
+    case OP_GUESTRETURN:
+    case OP_CYCLECOUNTER:
+    // These depend on the FPCR state set by SetRoundingMode and F80LoadFCW
+    case OP_GETROUNDINGMODE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Guest memory loads are kept in program order with each other to preserve TSO load-load ordering
+static bool IsGuestMemoryLoad(IROps Op) {
+  return Op == OP_LOADMEM ||
+         Op == OP_LOADMEMTSO ||
+         Op == OP_VLOADMEMELEMENT ||
+         Op == OP_STRINGSCAN16 ||
+         Op == OP_STRINGCOMPARE16;
+}
+
+// Rough result latencies of a narrow in-order Arm64 core
+static uint32_t GetLatency(IROps Op) {
+  switch (Op) {
+    case OP_LOADMEM:
+    case OP_LOADMEMTSO:
+    case OP_VLOADMEMELEMENT:
+    case OP_STRINGSCAN16:
+    case OP_STRINGCOMPARE16:
+      return 4;
+    case OP_LOADCONTEXT:
+    case OP_LOADCONTEXTINDEXED:
+    case OP_LOADFLAG:
+      return 3;
+    case OP_MUL:
+    case OP_UMUL:
+    case OP_MULH:
+    case OP_UMULH:
+    case OP_VUMUL:
+    case OP_VSMUL:
+    case OP_VUMULL:
+    case OP_VSMULL:
+    case OP_VUMULL2:
+    case OP_VSMULL2:
+    case OP_VFMUL:
+      return 3;
+    default:
+      return 1;
+  }
+}
+
+/**
+ * @brief Reorders the side effect free nodes between two scheduling barriers
+ *
+ * Classic top-down list scheduling. Each node is prioritized by the latency weighted height of its dependency chain,
+ * and a single issue in-order pipeline is modelled so that a load's consumers are pushed back behind independent work.
+ *
+ * @return true if the region was reordered
+ */
+bool InstructionScheduling::ScheduleRegion(IRListView *IR, OrderedNode *RegionEnd) {
+  if (Region.size() < 3) {
+    return false;
+  }
+
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+
+  Nodes.clear();
+  for (size_t i = 0; i < Region.size(); ++i) {
+    IDToIndex[IR->GetID(Region[i])] = i;
+    Nodes.push_back(SchedNode{Region[i], GetLatency(Region[i]->Op(DataBegin)->Op), 0, 0, 0, {}});
+  }
+
+  // Build the dependency graph. Only edges within the region matter, anything else is already available
+  int32_t LastMemoryLoad = -1;
+  for (size_t i = 0; i < Region.size(); ++i) {
+    auto IROp = Region[i]->Op(DataBegin);
+    uint8_t NumArgs = IR::GetArgs(IROp->Op);
+    for (uint8_t j = 0; j < NumArgs; ++j) {
+      auto ArgID = IROp->Args[j].ID();
+      if (ArgID < IDToIndex.size() && IDToIndex[ArgID] != -1) {
+        Nodes[IDToIndex[ArgID]].Succs.push_back(i);
+        ++Nodes[i].NumPreds;
+      }
+    }
+
+    if (IsGuestMemoryLoad(IROp->Op)) {
+      if (LastMemoryLoad != -1) {
+        Nodes[LastMemoryLoad].Succs.push_back(i);
+        ++Nodes[i].NumPreds;
+      }
+      LastMemoryLoad = i;
+    }
+  }
+
+  // Successors always come later in program order, so walking backwards visits them first
+  for (size_t i = Nodes.size(); i-- > 0;) {
+    uint32_t Height{};
+    for (auto Succ : Nodes[i].Succs) {
+      Height = std::max(Height, Nodes[Succ].Height);
+    }
+    Nodes[i].Height = Height + Nodes[i].Latency;
+  }
+
+  std::vector<uint32_t> Ready;
+  for (size_t i = 0; i < Nodes.size(); ++i) {
+    if (Nodes[i].NumPreds == 0) {
+      Ready.push_back(i);
+    }
+  }
+
+  std::vector<uint32_t> Order;
+  Order.reserve(Nodes.size());
+  uint32_t Cycle{};
+
+  while (!Ready.empty()) {
+    // Prefer a node whose operands are available this cycle, otherwise stall for the one available soonest
+    auto Best = Ready.begin();
+    for (auto it = Ready.begin() + 1; it != Ready.end(); ++it) {
+      auto &Candidate = Nodes[*it];
+      auto &Current = Nodes[*Best];
+      bool CandidateAvailable = Candidate.Earliest <= Cycle;
+      bool CurrentAvailable = Current.Earliest <= Cycle;
+
+      if (CandidateAvailable != CurrentAvailable) {
+        if (CandidateAvailable) {
+          Best = it;
+        }
+      }
+      else if (!CandidateAvailable && Candidate.Earliest != Current.Earliest) {
+        if (Candidate.Earliest < Current.Earliest) {
+          Best = it;
+        }
+      }
+      else if (Candidate.Height != Current.Height) {
+        if (Candidate.Height > Current.Height) {
+          Best = it;
+        }
+      }
+      else if (*it < *Best) {
+        // Fall back to program order for stability
+        Best = it;
+      }
+    }
+
+    uint32_t Index = *Best;
+    Ready.erase(Best);
+    Order.push_back(Index);
+
+    auto &Node = Nodes[Index];
+    Cycle = std::max(Cycle, Node.Earliest) + 1;
+
+    for (auto Succ : Node.Succs) {
+      auto &SuccNode = Nodes[Succ];
+      SuccNode.Earliest = std::max(SuccNode.Earliest, Cycle - 1 + Node.Latency);
+      if (--SuccNode.NumPreds == 0) {
+        Ready.push_back(Succ);
+      }
+    }
+  }
+
+  for (auto Node : Region) {
+    IDToIndex[IR->GetID(Node)] = -1;
+  }
+
+  LOGMAN_THROW_A_FMT(Order.size() == Region.size(), "Instruction scheduling dropped nodes");
+
+  bool Changed = false;
+  for (size_t i = 0; i < Order.size(); ++i) {
+    if (Order[i] != i) {
+      Changed = true;
+      break;
+    }
+  }
+
+  if (Changed) {
+    // Relink the region in its new order in front of the barrier that ends it
+    for (auto Index : Order) {
+      auto Node = Nodes[Index].Node;
+      Node->Unlink(ListBegin);
+      RegionEnd->prepend(ListBegin, Node);
+    }
+  }
+
+  return Changed;
+}
+
+/**
+ * @brief Schedules each run of side effect free nodes in every block to hide load latency
+ *
+ * This runs before RA rather than after it so that the allocator sees the final live ranges,
+ * instead of the scheduler having to work around the false dependencies created by register reuse.
+ */
+bool InstructionScheduling::Run(IREmitter *IREmit) {
+  auto CurrentIR = IREmit->ViewIR();
+  uintptr_t DataBegin = CurrentIR.GetData();
+  bool Changed = false;
+
+  IDToIndex.assign(CurrentIR.GetSSACount(), -1);
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    // Gather the block first, the list is rewritten underneath us as regions are scheduled
+    std::vector<OrderedNode*> BlockNodes;
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      BlockNodes.push_back(CodeNode);
+    }
+
+    Region.clear();
+    for (auto CodeNode : BlockNodes) {
+      auto Op = CodeNode->Op(DataBegin)->Op;
+
+      if (IsSchedulingBarrier(Op)) {
+        Changed |= ScheduleRegion(&CurrentIR, CodeNode);
+        Region.clear();
+        continue;
+      }
+
+      if (Region.size() == MaxRegionSize) {
+        // Close this region off at the current node, it is not part of it
+        Changed |= ScheduleRegion(&CurrentIR, CodeNode);
+        Region.clear();
+      }
+
+      Region.push_back(CodeNode);
+    }
+
+    // Blocks always end with a barrier, so any trailing region is an invalid block
+    LOGMAN_THROW_A_FMT(Region.empty(), "Block didn't end with a side effect");
+  }
+
+  return Changed;
+}
+
+std::unique_ptr<FEXCore::IR::Pass> CreateInstructionScheduling() {
+  return std::make_unique<InstructionScheduling>();
+}
+
+}
@@ -17,6 +17,7 @@ namespace FEXCore::Telemetry {
     "16Byte Split atomics",
     "VEX instructions (AVX)",
     "EVEX instructions (AVX512)",
+    "Active performance relaxations",
   };
   void Initialize() {
     auto DataDirectory = Config::GetDataDirectory();
@@ -30,6 +30,7 @@ namespace FEXCore::Config {
 
   enum class LayerType {
     LAYER_MAIN,
+    LAYER_PROFILE,
     LAYER_ARGUMENTS,
     LAYER_GLOBAL_APP,
     LAYER_LOCAL_APP,
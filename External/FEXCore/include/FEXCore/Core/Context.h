@@ -150,6 +150,17 @@ namespace FEXCore::Context {
    */
   FEX_DEFAULT_VISIBILITY void Step(FEXCore::Context::Context *CTX);
 
+  /**
+   * @brief Stops execution with EXIT_DEBUG before the instruction at RIP runs
+   *
+   * Code that was already compiled is invalidated. Only call these while the core is paused or stopped for the debugger.
+   *
+   * @param CTX The context that we created
+   * @param RIP The guest address to stop at
+   */
+  FEX_DEFAULT_VISIBILITY void AddBreakpoint(FEXCore::Context::Context *CTX, uint64_t RIP);
+  FEX_DEFAULT_VISIBILITY void RemoveBreakpoint(FEXCore::Context::Context *CTX, uint64_t RIP);
+
   /**
    * @brief [[threadsafe]] Returns the ExitReason of the parent thread. Typically used for async result status
    *
@@ -239,6 +250,8 @@ namespace FEXCore::Context {
   FEX_DEFAULT_VISIBILITY void FinalizeAOTIRCache(FEXCore::Context::Context *CTX);
   FEX_DEFAULT_VISIBILITY void WriteFilesWithCode(FEXCore::Context::Context *CTX, std::function<void(const std::string& fileid, const std::string& filename)> Writer);
   FEX_DEFAULT_VISIBILITY void FlushCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Start, uint64_t Length);
+  // Lets the debugger know the guest changed the mapping or protection of a range
+  FEX_DEFAULT_VISIBILITY void NotifyGuestMappingChanged(FEXCore::Context::Context *CTX, uint64_t Start, uint64_t Length);
 
   FEX_DEFAULT_VISIBILITY void ConfigureAOTGen(FEXCore::Core::InternalThreadState *Thread, std::set<uint64_t> *ExternalBranches, uint64_t SectionMaxAddress);
 }
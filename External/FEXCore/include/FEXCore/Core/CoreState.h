@@ -27,6 +27,10 @@ namespace FEXCore::Core {
     } gdt[32];
     uint16_t FCW;
     uint16_t FTW;
+    uint32_t : 32;
+
+    // Guest instructions run by this thread, backs the TSC in deterministic mode
+    uint64_t VirtualTSC;
   };
   static_assert(offsetof(CPUState, xmm) % 16 == 0, "xmm needs to be 128bit aligned!");
 
@@ -55,6 +59,9 @@ namespace FEXCore::Core {
 
   constexpr uint64_t PAGE_SIZE = 4096;
 
+  // Nominal frequency of CPUState::VirtualTSC, one guest instruction is one nanosecond
+  constexpr uint64_t VIRTUAL_TSC_FREQUENCY = 1'000'000'000;
+
   FEX_DEFAULT_VISIBILITY std::string_view const& GetFlagName(unsigned Flag);
   FEX_DEFAULT_VISIBILITY std::string_view const& GetGRegName(unsigned Reg);
 }
@@ -75,6 +75,8 @@ namespace FEXCore::Core {
     struct {
       std::atomic_bool Running {false};
       std::atomic_bool WaitingToStart {false};
+      // Parked in the pause handler, waiting for StartRunning
+      std::atomic_bool Sleeping {false};
     } RunningEvents;
 
     FEXCore::Context::Context *CTX;
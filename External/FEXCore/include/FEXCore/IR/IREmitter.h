@@ -81,6 +81,9 @@ friend class FEXCore::IR::PassManager;
   IRPair<IROp_StoreMemTSO> _StoreMemTSO(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *ssa0, OrderedNode *ssa1, uint8_t Align = 1) {
     return _StoreMemTSO(ssa0, ssa1, Invalid(), Size, Align, Class, MEM_OFFSET_SXTX, 1);
   }
+  IRPair<IROp_StoreMemNonTemporal> _StoreMemNonTemporal(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *ssa0, OrderedNode *ssa1, uint8_t Align = 1) {
+    return _StoreMemNonTemporal(ssa0, ssa1, Size, Align, Class);
+  }
   IRPair<IROp_VStoreMemElement> _VStoreMemElement(uint8_t RegisterSize, uint8_t ElementSize, OrderedNode *ssa0, OrderedNode *ssa1, uint8_t Index, uint8_t Align = 1) {
     return _VStoreMemElement(ssa0, ssa1, Index, Align, RegisterSize, ElementSize);
   }
@@ -189,6 +192,15 @@ friend class FEXCore::IR::PassManager;
   IRPair<IROp_VUnZip2> _VUnZip2(uint8_t RegisterSize, uint8_t ElementSize, OrderedNode *ssa0, OrderedNode *ssa1) {
     return _VUnZip2(ssa0, ssa1, RegisterSize, ElementSize);
   }
+  IRPair<IROp_VTrn> _VTrn(uint8_t RegisterSize, uint8_t ElementSize, OrderedNode *ssa0, OrderedNode *ssa1) {
+    return _VTrn(ssa0, ssa1, RegisterSize, ElementSize);
+  }
+  IRPair<IROp_VTrn2> _VTrn2(uint8_t RegisterSize, uint8_t ElementSize, OrderedNode *ssa0, OrderedNode *ssa1) {
+    return _VTrn2(ssa0, ssa1, RegisterSize, ElementSize);
+  }
+  IRPair<IROp_VRev64> _VRev64(uint8_t RegisterSize, uint8_t ElementSize, OrderedNode *ssa0) {
+    return _VRev64(ssa0, RegisterSize, ElementSize);
+  }
   IRPair<IROp_VCMPEQ> _VCMPEQ(uint8_t RegisterSize, uint8_t ElementSize, OrderedNode *ssa0, OrderedNode *ssa1) {
     return _VCMPEQ(ssa0, ssa1, RegisterSize, ElementSize);
   }
@@ -29,6 +29,7 @@ namespace FEXCore::Telemetry {
     TYPE_16BYTE_SPLIT,
     TYPE_USES_VEX_OPS,
     TYPE_USES_EVEX_OPS,
+    TYPE_PERF_RELAXATIONS,
     TYPE_LAST,
   };
 
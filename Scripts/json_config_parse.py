@@ -148,6 +148,7 @@ def parse_json(json_text, output_file):
     OptionRegData = {}
     OptionMemoryRegions = {}
     OptionMemoryData = {}
+    OptionBreakpoints = []
 
 
     json_object = json.loads(json_text)
@@ -242,6 +243,15 @@ def parse_json(json_text, output_file):
             length, byte_data = parse_hexstring(data_val)
             OptionMemoryData[int(data_key, 0)] = (length, byte_data)
 
+    if ("BREAKPOINTS" in json_object):
+        data = json_object["BREAKPOINTS"]
+        if (type(data) is str):
+            data = [data]
+
+        # Hit in the order they are listed, each one is only armed once the previous one was hit
+        for data_val in data:
+            OptionBreakpoints.append(int(data_val, 0))
+
     # If Match option wasn't touched then set it to the default
     if (OptionMatch == Regs.REG_INVALID):
         OptionMatch = Regs.REG_NONE
@@ -250,6 +260,7 @@ def parse_json(json_text, output_file):
     memRegions = bytes()
     regData = bytes()
     memData = bytes()
+    breakpointData = bytes()
 
     # Write memory regions
     for key, val in OptionMemoryRegions.items():
@@ -271,6 +282,10 @@ def parse_json(json_text, output_file):
         for byte in data:
             memData += struct.pack('B', byte)
 
+    # Write breakpoints
+    for val in OptionBreakpoints:
+        breakpointData += struct.pack('Q', val)
+
     config_file = open(output_file, "wb")
     config_file.write(struct.pack('Q', OptionMatch.value))
     config_file.write(struct.pack('Q', OptionIgnore.value))
@@ -280,7 +295,7 @@ def parse_json(json_text, output_file):
     config_file.write(struct.pack('I', OptionMode.value))
 
     # Total length of header, including offsets/counts below
-    headerLength = (8 * 4) + (4 * 2) + (4 * 6)
+    headerLength = (8 * 4) + (4 * 2) + (4 * 8)
     offset = headerLength
 
     #  memory regions offset/count
@@ -298,10 +313,16 @@ def parse_json(json_text, output_file):
     config_file.write(struct.pack('I', len(OptionMemoryData)))
     offset += len(memData)
 
-    # write out the actual data for memory regions, reg data and memory data
+    # breakpoints offset/count
+    config_file.write(struct.pack('I', offset))
+    config_file.write(struct.pack('I', len(OptionBreakpoints)))
+    offset += len(breakpointData)
+
+    # write out the actual data for memory regions, reg data, memory data and breakpoints
     config_file.write(memRegions)
     config_file.write(regData)
     config_file.write(memData)
+    config_file.write(breakpointData)
 
     config_file.close()
 
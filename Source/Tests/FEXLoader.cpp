@@ -23,7 +23,9 @@ $end_info$
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXCore/Utils/Telemetry.h>
 
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <string>
 #include <unistd.h>
@@ -35,6 +37,7 @@ $end_info$
 #include <thread>
 #include <queue>
 
+#include <sys/personality.h>
 #include <sys/sysinfo.h>
 
 namespace {
@@ -382,6 +385,23 @@ int main(int argc, char **argv, char **const envp) {
     }
   }
 
+  // Deterministic runs want the same host and guest addresses every time.
+  // Come back through exec with address randomization disabled, the kernel only applies it at exec.
+  FEX_CONFIG_OPT(Deterministic, DETERMINISTIC);
+  if (Deterministic) {
+    int Persona = personality(0xFFFFFFFF);
+    if (Persona != -1 && !(Persona & ADDR_NO_RANDOMIZE)) {
+      if (ExecutedWithFD) {
+        // The exec FD doesn't survive another exec
+        LogMan::Msg::EFmt("Deterministic: Can't disable address randomization when run through binfmt_misc with an exec FD");
+      }
+      else if (personality(Persona | ADDR_NO_RANDOMIZE) != -1) {
+        execve("/proc/self/exe", argv, envp);
+        LogMan::Msg::EFmt("Deterministic: Couldn't re-exec without address randomization: {}", strerror(errno));
+      }
+    }
+  }
+
   // Ensure RootFS is setup before config options try to pull CONFIG_ROOTFS
   if (!FEX::RootFS::Setup(envp)) {
     LogMan::Msg::E("RootFS failure");
@@ -290,6 +290,21 @@ namespace FEX::HarnessHelper {
       }
     }
 
+    std::vector<uint64_t> GetBreakpoints() const {
+      std::vector<uint64_t> Breakpoints;
+
+      uintptr_t DataOffset = BaseConfig.OptionBreakpointOffset;
+      for (unsigned i = 0; i < BaseConfig.OptionBreakpointCount; ++i) {
+        uint64_t Breakpoint;
+        memcpy(&Breakpoint, RawConfigFile.data() + DataOffset, sizeof(Breakpoint));
+        Breakpoints.emplace_back(Breakpoint);
+
+        DataOffset += sizeof(uint64_t);
+      }
+
+      return Breakpoints;
+    }
+
     bool Is64BitMode() const { return BaseConfig.OptionMode == 1; }
 
   private:
@@ -308,6 +323,8 @@ namespace FEX::HarnessHelper {
       uint32_t OptionRegDataCount;
       uint32_t OptionMemDataOffset;
       uint32_t OptionMemDataCount;
+      uint32_t OptionBreakpointOffset;
+      uint32_t OptionBreakpointCount;
       uint8_t  AdditionalData[];
     } FEX_PACKED;
 
@@ -422,6 +439,7 @@ namespace FEX::HarnessHelper {
     }
 
     bool Is64BitMode() const { return Config.Is64BitMode(); }
+    std::vector<uint64_t> GetBreakpoints() const { return Config.GetBreakpoints(); }
 
   private:
     constexpr static uint64_t STACK_SIZE = PAGE_SIZE;
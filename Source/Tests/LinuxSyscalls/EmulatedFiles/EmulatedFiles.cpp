@@ -6,7 +6,10 @@ $end_info$
 */
 
 #include <cstring>
+#include <fcntl.h>
 #include <filesystem>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <FEXCore/Utils/LogManager.h>
 #include "FEXCore/Core/CodeLoader.h"
@@ -20,22 +23,60 @@ using string = std::string;
 
 namespace FEX::EmulatedFile {
   /**
-   * @brief Generates a temporary file using raw FDs
+   * @brief Generates a sealed memfd holding the contents of an emulated file
    *
    * Since we are hooking syscalls that are expecting to use raw FDs, we need to make sure to also use raw FDs.
-   * The guest application can leave these FDs dangling.
+   * This FD is owned by FEX and each guest open gets its own file description through ReopenSealedFD.
    *
-   * Using glibc tmpfile creates a FILE which glibc tracks and will try cleaning up on application exit.
-   * If we are running a 32-bit application then this dangling FILE will be allocated using the FEX allcator
-   * Which will have already been cleaned up on shutdown.
+   * Using a memfd instead of a file in /tmp means we don't depend on /tmp existing, being fast or having space.
    *
-   * Dangling raw FD is safe since if the guest doesn't close them, then the kernel cleans them up on application close.
+   * @return A sealed memfd with the contents or -1 on failure
+   */
+  static int GenSealedFD(std::string const &Contents) {
+    int FD = memfd_create("FEXEmulatedFile", MFD_ALLOW_SEALING | MFD_CLOEXEC);
+    if (FD == -1) {
+      return -1;
+    }
+
+    size_t Offset = 0;
+    while (Offset < Contents.size()) {
+      ssize_t Written = write(FD, Contents.data() + Offset, Contents.size() - Offset);
+      if (Written <= 0) {
+        close(FD);
+        return -1;
+      }
+      Offset += Written;
+    }
+
+    fcntl(FD, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+    return FD;
+  }
+
+  /**
+   * @brief Opens a new file description for a sealed memfd
    *
-   * @return A temporary file that we can use
+   * A dup would share the file offset between every guest open of the same file.
+   * The guest can close or replace FDs it doesn't own, so the identity of the FD is checked on every open.
+   *
+   * @return The new FD or -1 if the memfd is no longer ours
    */
-  static int GenTmpFD() {
-    int fd = open("/tmp", O_RDWR | O_TMPFILE | O_EXCL |  S_IRUSR | S_IWUSR);
-    return fd;
+  static int ReopenSealedFD(int FD, dev_t Device, ino_t Inode, int flags) {
+    char Path[32];
+    snprintf(Path, sizeof(Path), "/proc/self/fd/%d", FD);
+    int NewFD = open(Path, O_RDONLY | (flags & O_CLOEXEC));
+    if (NewFD == -1) {
+      return -1;
+    }
+
+    struct stat Stat{};
+    if (fstat(NewFD, &Stat) == -1 ||
+        Stat.st_dev != Device ||
+        Stat.st_ino != Inode) {
+      close(NewFD);
+      return -1;
+    }
+
+    return NewFD;
   }
 
   std::string GenerateCPUInfo(FEXCore::Context::Context *ctx, uint32_t CPUCores) {
@@ -609,15 +650,11 @@ namespace FEX::EmulatedFile {
 
   EmulatedFDManager::EmulatedFDManager(FEXCore::Context::Context *ctx)
     : CTX {ctx} {
-    FDReadCreators["/proc/cpuinfo"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
-      write(FD, (void*)&cpu_info.at(0), cpu_info.size());
-      lseek(FD, 0, SEEK_SET);
-      return FD;
+    FDReadCreators["/proc/cpuinfo"].Generate = [&]() -> std::optional<std::string> {
+      return GenerateCPUInfo(CTX, ThreadsConfig());
     };
 
-    FDReadCreators["/proc/sys/kernel/osrelease"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
+    FDReadCreators["/proc/sys/kernel/osrelease"].Generate = [&]() -> std::optional<std::string> {
       uint32_t GuestVersion = FEX::HLE::_SyscallHandler->GetGuestKernelVersion();
       char Tmp[64]{};
       snprintf(Tmp, sizeof(Tmp), "%d.%d.%d\n",
@@ -625,13 +662,10 @@ namespace FEX::EmulatedFile {
         FEX::HLE::SyscallHandler::KernelMinor(GuestVersion),
         FEX::HLE::SyscallHandler::KernelPatch(GuestVersion));
       // + 1 to ensure null at the end
-      write(FD, Tmp, strlen(Tmp) + 1);
-      lseek(FD, 0, SEEK_SET);
-      return FD;
+      return std::string(Tmp, strlen(Tmp) + 1);
     };
 
-    FDReadCreators["/proc/version"] = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
+    FDReadCreators["/proc/version"].Generate = [&]() -> std::optional<std::string> {
       // UTS version NEEDS to be in a format that can pass to `date -d`
       // Format of this is Linux version <Release> (<Compile By>@<Compile Host>) (<Linux Compiler>) #<version> {SMP, PREEMPT, PREEMPT_RT} <UTS version>\n"
       const char kernel_version[] = "Linux version %d.%d.%d (FEX@FEX) (clang) #" GIT_DESCRIBE_STRING " SMP " __DATE__ " " __TIME__ "\n";
@@ -642,47 +676,40 @@ namespace FEX::EmulatedFile {
         FEX::HLE::SyscallHandler::KernelMinor(GuestVersion),
         FEX::HLE::SyscallHandler::KernelPatch(GuestVersion));
       // + 1 to ensure null at the end
-      write(FD, Tmp, strlen(Tmp) + 1);
-      lseek(FD, 0, SEEK_SET);
-      return FD;
+      return std::string(Tmp, strlen(Tmp) + 1);
     };
 
-    auto NumCPUCores = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
-      write(FD, (void*)&cpus_online.at(0), cpus_online.size());
-      lseek(FD, 0, SEEK_SET);
-      return FD;
+    auto NumCPUCores = [&]() -> std::optional<std::string> {
+      return cpus_online;
     };
 
-    FDReadCreators["/sys/devices/system/cpu/online"] = NumCPUCores;
-    FDReadCreators["/sys/devices/system/cpu/present"] = NumCPUCores;
+    FDReadCreators["/sys/devices/system/cpu/online"].Generate = NumCPUCores;
+    FDReadCreators["/sys/devices/system/cpu/present"].Generate = NumCPUCores;
 
     string procAuxv = string("/proc/") + std::to_string(getpid()) + string("/auxv");
 
-    FDReadCreators[procAuxv] = &EmulatedFDManager::ProcAuxv;
-    FDReadCreators["/proc/self/auxv"] = &EmulatedFDManager::ProcAuxv;
+    FDReadCreators[procAuxv].Generate = &EmulatedFDManager::ProcAuxv;
+    FDReadCreators["/proc/self/auxv"].Generate = &EmulatedFDManager::ProcAuxv;
 
-    auto cmdline_handler = [&](FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode) -> int32_t {
-      int FD = GenTmpFD();
+    auto cmdline_handler = [&]() -> std::optional<std::string> {
       auto CodeLoader = FEX::HLE::_SyscallHandler->GetCodeLoader();
       auto Args = CodeLoader->GetApplicationArguments();
-      char NullChar{};
+      std::string Contents{};
       // cmdline is an array of null terminated arguments
       for (size_t i = 1; i < Args->size(); ++i) {
         auto &Arg = Args->at(i);
-        write(FD, Arg.c_str(), Arg.size());
+        Contents.append(Arg);
         // Finish off with a null terminator
-        write(FD, &NullChar, sizeof(uint8_t));
+        Contents.push_back('\0');
       }
 
       // One additional null terminator to finish the list
-      write(FD, &NullChar, sizeof(uint8_t));
-      lseek(FD, 0, SEEK_SET);
-      return FD;
+      Contents.push_back('\0');
+      return Contents;
     };
 
-    FDReadCreators["/proc/self/cmdline"] = cmdline_handler;
-    FDReadCreators["/proc/" + std::to_string(::getpid()) + "/cmdline"] = cmdline_handler;
+    FDReadCreators["/proc/self/cmdline"].Generate = cmdline_handler;
+    FDReadCreators["/proc/" + std::to_string(::getpid()) + "/cmdline"].Generate = cmdline_handler;
 
     cpus_online = "0";
     uint64_t CPUCores = ThreadsConfig();
@@ -690,21 +717,33 @@ namespace FEX::EmulatedFile {
       cpus_online += "-" + std::to_string(CPUCores - 1);
     }
 
-    cpu_info = GenerateCPUInfo(ctx, CPUCores);
+    // Overmounts like lxcfs can put emulated files on their own device, so every one is checked
+    for (auto &[Path, File] : FDReadCreators) {
+      struct stat Stat{};
+      if (stat(Path.c_str(), &Stat) == 0) {
+        EmulatedDevices.insert(Stat.st_dev);
+      }
+    }
   }
 
   EmulatedFDManager::~EmulatedFDManager() {
   }
 
   int32_t EmulatedFDManager::OpenAt(int dirfs, const char *pathname, int flags, uint32_t mode) {
-    if (!pathname || strlen(pathname) == 0) {
+    if (!pathname || pathname[0] == '\0') {
       return -1;
     }
-    std::error_code ec;
-    bool exists = std::filesystem::exists(pathname, ec);
-    if (ec) {
+
+    // Repeated slashes, dot components and symlinks can all lead to an emulated file, so the prefilter looks at
+    // what the path resolves to. A file on a device that no emulated file lives on can't match,
+    // which skips the readlink syscalls of canonicalisation for nearly every open.
+    struct stat Stat{};
+    bool exists = stat(pathname, &Stat) == 0;
+    if (exists && !EmulatedDevices.contains(Stat.st_dev)) {
       return -1;
     }
+
+    std::error_code ec;
     string cpath = exists ? std::filesystem::canonical(pathname, ec)
       : std::filesystem::path(pathname).lexically_normal(); // *Note: this doesn't transform to absolute
 
@@ -716,22 +755,53 @@ namespace FEX::EmulatedFile {
       return -1;
     }
 
-    return Creator->second(CTX, dirfs, pathname, flags, mode);
+    return OpenEmulatedFile(Creator->second, flags);
   }
 
-  int32_t EmulatedFDManager::ProcAuxv(FEXCore::Context::Context* ctx, int32_t fd, const char* pathname, int32_t flags, mode_t mode)
-  {
+  int32_t EmulatedFDManager::OpenEmulatedFile(EmulatedFile &File, int flags) {
+    std::scoped_lock lk(EmulatedFileLock);
+
+    if (File.FD != -1) {
+      int FD = ReopenSealedFD(File.FD, File.Device, File.Inode, flags);
+      if (FD != -1) {
+        return FD;
+      }
+
+      // The guest closed or replaced our memfd, the FD number isn't ours to close anymore
+      File.FD = -1;
+    }
+
+    auto Contents = File.Generate();
+    if (!Contents) {
+      return -1;
+    }
+
+    int FD = GenSealedFD(*Contents);
+    if (FD == -1) {
+      return -1;
+    }
+
+    struct stat Stat{};
+    if (fstat(FD, &Stat) == -1) {
+      close(FD);
+      return -1;
+    }
+
+    File.FD = FD;
+    File.Device = Stat.st_dev;
+    File.Inode = Stat.st_ino;
+    return ReopenSealedFD(File.FD, File.Device, File.Inode, flags);
+  }
+
+  std::optional<std::string> EmulatedFDManager::ProcAuxv() {
     uint64_t auxvBase=0, auxvSize=0;
     FEX::HLE::_SyscallHandler->GetCodeLoader()->GetAuxv(auxvBase, auxvSize);
     if (!auxvBase) {
       LogMan::Msg::D("Failed to get Auxv stack address");
-      return -1;
+      return std::nullopt;
     }
 
-    int FD = GenTmpFD();
-    write(FD, (void*)auxvBase, auxvSize);
-    lseek(FD, 0, SEEK_SET);
-    return FD;
+    return std::string(reinterpret_cast<const char*>(auxvBase), auxvSize);
   }
 }
 
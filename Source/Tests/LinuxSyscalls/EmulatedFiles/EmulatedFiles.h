@@ -9,9 +9,12 @@ $end_info$
 
 #include <cstdint>
 #include <functional>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
+#include <sys/types.h>
 
 namespace FEXCore {
   class FD;
@@ -30,11 +33,24 @@ namespace FEX::EmulatedFile {
     private:
       FEXCore::Context::Context *CTX;
       std::string cpus_online{};
-      std::string cpu_info{};
-      using FDReadStringFunc = std::function<int32_t(FEXCore::Context::Context *ctx, int32_t fd, const char *pathname, int32_t flags, mode_t mode)>;
-      std::unordered_map<std::string, FDReadStringFunc> FDReadCreators;
 
-      static int32_t ProcAuxv(FEXCore::Context::Context* ctx, int32_t fd, const char* pathname, int32_t flags, mode_t mode);
+      using GenerateContentsFunc = std::function<std::optional<std::string>()>;
+
+      // Contents are generated on first open and kept in a sealed memfd for the lifetime of the process
+      struct EmulatedFile {
+        GenerateContentsFunc Generate;
+        int FD{-1};
+        dev_t Device{};
+        ino_t Inode{};
+      };
+
+      std::mutex EmulatedFileLock;
+      std::unordered_map<std::string, EmulatedFile> FDReadCreators;
+      // Devices the emulated files live on
+      std::unordered_set<dev_t> EmulatedDevices;
+
+      int32_t OpenEmulatedFile(EmulatedFile &File, int flags);
+      static std::optional<std::string> ProcAuxv();
       FEX_CONFIG_OPT(ThreadsConfig, THREADS);
   };
 }
@@ -55,7 +55,14 @@ namespace FEX::HLE {
     FEXCore::GuestSAMask PreviousSuspendMask{};
 
     uint32_t CurrentSignal{};
-    uint64_t PendingSignals{};
+    // Signals blocked on the host, always a subset of CurrentSignalMask.
+    // The rest of the guest's mask is only blocked on the host once a syscall could be interrupted or a signal arrives.
+    // Atomic since the signal handler can update it underneath GuestSigProcMask
+    std::atomic<uint64_t> HostBlockedSignals{};
+    // Signals that arrived while the guest had them blocked and the kernel wouldn't queue again.
+    // Raised again with their siginfo once the guest unblocks them.
+    std::atomic<uint64_t> PendingSignals{};
+    siginfo_t PendingSigInfo[SignalDelegator::MAX_SIGNALS]{};
     bool Suspended {false};
   };
 
@@ -94,6 +101,52 @@ namespace FEX::HLE {
     ThreadData.CurrentSignal = Signal;
   }
 
+  static void DeferSignal(int Signal, siginfo_t *SigInfo, void *UContext) {
+    uint64_t SignalBit = 1ULL << (Signal - 1);
+    ThreadData.HostBlockedSignals |= SignalBit;
+
+    // Block it for the rest of this handler and once the handler returns
+    ::syscall(SYS_rt_sigprocmask, SIG_BLOCK, &SignalBit, nullptr, 8);
+    sigaddset(&static_cast<ucontext_t*>(UContext)->uc_sigmask, Signal);
+
+    // Now hand it back to the kernel, which keeps the siginfo intact while it is pending.
+    // It goes back to this thread since the kernel already picked it, sending it process wide could bounce it between threads.
+    auto &ThreadManager = ThreadData.Thread->ThreadManager;
+    if (::syscall(SYS_rt_tgsigqueueinfo, ThreadManager.GetPID(), ThreadManager.GetTID(), Signal, SigInfo) != 0) {
+      // Most likely the RT signal queue limit, keep it ourselves rather than dropping it
+      ThreadData.PendingSigInfo[Signal - 1] = *SigInfo;
+      ThreadData.PendingSignals |= SignalBit;
+    }
+  }
+
+  // Raises the signals we had to keep ourselves that the guest no longer blocks
+  static void RaisePendingSignals() {
+    uint64_t Ready = ThreadData.PendingSignals.load() & ~ThreadData.CurrentSignalMask.Val;
+    auto &ThreadManager = ThreadData.Thread->ThreadManager;
+
+    for (int i = 0; i < SignalDelegator::MAX_SIGNALS; ++i) {
+      if (!(Ready & (1ULL << i))) {
+        continue;
+      }
+
+      siginfo_t SigInfo = ThreadData.PendingSigInfo[i];
+      ThreadData.PendingSignals.fetch_and(~(1ULL << i));
+      if (::syscall(SYS_rt_tgsigqueueinfo, ThreadManager.GetPID(), ThreadManager.GetTID(), i + 1, &SigInfo) != 0) {
+        // Still no room, at least the signal itself arrives
+        ::syscall(SYS_tgkill, ThreadManager.GetPID(), ThreadManager.GetTID(), i + 1);
+      }
+    }
+  }
+
+  // Blocks signals on the host that the guest has blocked, limited to Mask
+  static void BlockGuestMaskedSignals(uint64_t Mask) {
+    uint64_t Missing = ThreadData.CurrentSignalMask.Val & ~ThreadData.HostBlockedSignals.load() & Mask;
+    if (Missing) {
+      ThreadData.HostBlockedSignals |= Missing;
+      ::syscall(SYS_rt_sigprocmask, SIG_BLOCK, &Missing, nullptr, 8);
+    }
+  }
+
   void SignalDelegator::HandleSignal(int Signal, void *Info, void *UContext) {
     // Let the host take first stab at handling the signal
     siginfo_t *SigInfo = static_cast<siginfo_t*>(Info);
@@ -136,9 +189,12 @@ namespace FEX::HLE {
         }
       }
 
-      // Check the thread's current signal mask
-      if (SigIsMember(&ThreadData.CurrentSignalMask, Signal) != ThreadData.Suspended) {
-        ThreadData.PendingSignals |= 1ULL << (Signal - 1);
+      // The guest's signal mask only exists here, the host doesn't block anything until a signal arrives that the guest has blocked.
+      // Faults and our own required signals can't be blocked on the host, those go through regardless.
+      if (SigIsMember(&ThreadData.CurrentSignalMask, Signal) &&
+          !(IsSynchronous(Signal) && SigInfo->si_code > 0) &&
+          !(RequiredSignalsMask.load(std::memory_order_relaxed) & (1ULL << (Signal - 1)))) {
+        DeferSignal(Signal, SigInfo, UContext);
         return;
       }
 
@@ -159,9 +215,6 @@ namespace FEX::HLE {
 
       ThreadData.CurrentSignal = Signal;
 
-      // Remove the pending signal
-      ThreadData.PendingSignals &= ~(1ULL << (Signal - 1));
-
       // We have an emulation thread pointer, we can now modify its state
       if (Handler.GuestAction.sigaction_handler.handler == SIG_DFL) {
         if (Handler.DefaultBehaviour == DEFAULT_TERM) {
@@ -230,6 +283,9 @@ namespace FEX::HLE {
     bool Result = UpdateHostThunk(Signal);
 
     SignalHandler.Installed = Result;
+    if (Result) {
+      InstalledSignalsMask.fetch_or(1ULL << (Signal - 1));
+    }
     return Result;
   }
 
@@ -260,14 +316,9 @@ namespace FEX::HLE {
     // This'll likely be SIGILL, SIGBUS, SIG63
 
     // If the guest has masked some signals then we need to also mask those signals
-    for (size_t i = 1; i < HostHandlers.size(); ++i) {
-      if (HostHandlers[i].Required.load(std::memory_order_relaxed)) {
-        SignalHandler.HostAction.sa_mask &= ~(1ULL << (i - 1));
-      }
-      else if (SigIsMember(&SignalHandler.GuestAction.sa_mask, i)) {
-        SignalHandler.HostAction.sa_mask |= (1ULL << (i - 1));
-      }
-    }
+    uint64_t Required = RequiredSignalsMask.load(std::memory_order_relaxed);
+    SignalHandler.HostAction.sa_mask |= SignalHandler.GuestAction.sa_mask.Val;
+    SignalHandler.HostAction.sa_mask &= ~Required;
 
     // Only update the old action if we haven't ever been installed
     int Result = ::syscall(SYS_rt_sigaction, Signal, &SignalHandler.HostAction, SignalHandler.Installed ? nullptr : &SignalHandler.OldAction, 8);
@@ -350,6 +401,9 @@ namespace FEX::HLE {
 
     // Get the current host signal mask
     ::syscall(SYS_rt_sigprocmask, 0, nullptr, &ThreadData.CurrentSignalMask.Val, 8);
+
+    // Whatever we inherited is blocked on the host for real, the guest unblocking it needs to reach the host
+    ThreadData.HostBlockedSignals = ThreadData.CurrentSignalMask.Val;
   }
 
   void SignalDelegator::UninstallTLSState(FEXCore::Core::InternalThreadState *Thread) {
@@ -413,12 +467,31 @@ namespace FEX::HLE {
     return true;
   }
 
+  void SignalDelegator::SyncHostSignalMask() {
+    uint64_t HostMask = ThreadData.CurrentSignalMask.Val & ~RequiredSignalsMask.load(std::memory_order_relaxed);
+    ThreadData.HostBlockedSignals = HostMask;
+    ::syscall(SYS_rt_sigprocmask, SIG_SETMASK, &HostMask, nullptr, 8);
+  }
+
+  void SignalDelegator::BlockHostSignalsForSyscall() {
+    BlockGuestMaskedSignals(~RequiredSignalsMask.load(std::memory_order_relaxed));
+  }
+
+  void SignalDelegator::SetRequired(int Signal, bool Required) {
+    if (Required) {
+      RequiredSignalsMask.fetch_or(1ULL << (Signal - 1));
+    }
+    else {
+      RequiredSignalsMask.fetch_and(~(1ULL << (Signal - 1)));
+    }
+  }
+
   void SignalDelegator::RegisterHostSignalHandler(int Signal, FEXCore::HostSignalDelegatorFunction Func, bool Required) {
     // Linux signal handlers are per-process rather than per thread
     // Multiple threads could be calling in to this
     std::lock_guard lk(HostDelegatorMutex);
     HostHandlers[Signal].Handler = std::move(Func);
-    HostHandlers[Signal].Required = Required;
+    SetRequired(Signal, Required);
     InstallHostThunk(Signal);
   }
 
@@ -427,7 +500,7 @@ namespace FEX::HLE {
     // Multiple threads could be calling in to this
     std::lock_guard lk(HostDelegatorMutex);
     HostHandlers[Signal].FrontendHandler = std::move(Func);
-    HostHandlers[Signal].Required = Required;
+    SetRequired(Signal, Required);
     InstallHostThunk(Signal);
   }
 
@@ -524,19 +597,6 @@ namespace FEX::HLE {
     return 0;
   }
 
-  static void CheckForPendingSignals() {
-    // Do we have any pending signals that became unmasked?
-    uint64_t PendingSignals = ~ThreadData.CurrentSignalMask.Val & ThreadData.PendingSignals;
-    if (PendingSignals != 0) {
-      for (int i = 0; i < 64; ++i) {
-        if (PendingSignals & (1ULL << i)) {
-          tgkill(ThreadData.Thread->ThreadManager.PID, ThreadData.Thread->ThreadManager.TID, i + 1);
-          // We might not even return here which is spooky
-        }
-      }
-    }
-  }
-
   uint64_t SignalDelegator::GuestSigProcMask(int how, const uint64_t *set, uint64_t *oldset) {
     if (!!oldset) {
       *oldset = ThreadData.CurrentSignalMask.Val;
@@ -557,21 +617,20 @@ namespace FEX::HLE {
         return -EINVAL;
       }
 
-      uint64_t HostMask = ThreadData.CurrentSignalMask.Val;
-      // Now actually set the host mask
-      // This will hide from the guest that we are not actually setting all of the masks it wants
-      for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-        if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-          // If it is a required host signal then we can't mask it
-          HostMask &= ~(1ULL << i);
-        }
+      // Blocking is lazy, the host mask only catches up when a signal arrives or before the next syscall.
+      // Signals without our thunk would take the host's default action, those have to be blocked right away.
+      BlockGuestMaskedSignals(~InstalledSignalsMask.load(std::memory_order_relaxed) & ~RequiredSignalsMask.load(std::memory_order_relaxed));
+
+      // Unblocking reaches the host immediately, the kernel then delivers anything deferred right away
+      uint64_t Unblocked = ThreadData.HostBlockedSignals.load() & ~ThreadData.CurrentSignalMask.Val;
+      if (Unblocked) {
+        ThreadData.HostBlockedSignals.fetch_and(~Unblocked);
+        ::syscall(SYS_rt_sigprocmask, SIG_UNBLOCK, &Unblocked, nullptr, 8);
       }
 
-      ::syscall(SYS_rt_sigprocmask, SIG_SETMASK, &HostMask, nullptr, 8);
+      RaisePendingSignals();
     }
 
-    CheckForPendingSignals();
-
     return 0;
   }
 
@@ -580,7 +639,8 @@ namespace FEX::HLE {
       return -EINVAL;
     }
 
-    *set = ThreadData.PendingSignals;
+    // Deferred signals are waiting in the kernel's queue, other than the ones it wouldn't take
+    *set = ThreadData.PendingSignals.load();
 
     sigset_t HostSet{};
     if (sigpending(&HostSet) == 0) {
@@ -609,26 +669,28 @@ namespace FEX::HLE {
     // Set the new mask
     ThreadData.CurrentSignalMask.Val = *set & IgnoredSignalsMask;
     ThreadData.Suspended = true;
-    sigset_t HostSet{};
 
-    sigemptyset(&HostSet);
-
-    for (int32_t i = 0; i < MAX_SIGNALS; ++i) {
-      if (*set & (1ULL << i)) {
-        sigaddset(&HostSet, i + 1);
-      }
-    }
+    // Required signals still need to get through while waiting
+    uint64_t HostMask = ThreadData.CurrentSignalMask.Val & ~RequiredSignalsMask.load(std::memory_order_relaxed);
 
     // Additionally we must always listen to SIGNAL_FOR_PAUSE
     // This technically forces us in to a race but should be fine
     // SIGBUS and SIGILL can't happen so we don't need to listen for them
     //sigaddset(&HostSet, SIGNAL_FOR_PAUSE);
 
+    // Anything we kept ourselves that the suspend mask lets through has to wake us up
+    RaisePendingSignals();
+
     // Spin this in a loop until we aren't sigsuspended
     // This can happen in the case that the guest has sent signal that we can't block
-    uint64_t Result = sigsuspend(&HostSet);
+    uint64_t Result = ::syscall(SYS_rt_sigsuspend, &HostMask, 8);
 
-    CheckForPendingSignals();
+    if (ThreadData.Suspended) {
+      // Woken up by one of our own signals rather than a guest one, restore the mask here instead
+      ThreadData.CurrentSignalMask = ThreadData.PreviousSuspendMask;
+      ThreadData.PreviousSuspendMask.Val = 0;
+      ThreadData.Suspended = false;
+    }
 
     return Result == -1 ? -errno : Result;
 
@@ -661,13 +723,10 @@ namespace FEX::HLE {
     sigset_t HostSet{};
     sigemptyset(&HostSet);
 
+    // For now skip our internal signals
+    uint64_t GuestSignals = ThreadData.CurrentSignalMask.Val & ~RequiredSignalsMask.load(std::memory_order_relaxed);
     for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-      if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-        // For now skip our internal signals
-        continue;
-      }
-
-      if (ThreadData.CurrentSignalMask.Val & (1ULL << i)) {
+      if (GuestSignals & (1ULL << i)) {
         sigaddset(&HostSet, i + 1);
       }
     }
@@ -57,6 +57,22 @@ namespace FEX::HLE {
     static bool BlockSignal(int Signal);
     static bool UnblockSignal(int Signal);
 
+    /**
+     * @brief Makes the host signal mask match the guest's signal mask
+     *
+     * The guest mask is normally only tracked virtually.
+     * Anything that inherits the host mask (new threads, execve) needs to call this first.
+     */
+    void SyncHostSignalMask();
+
+    /**
+     * @brief Blocks everything on the host that the guest has blocked
+     *
+     * Called before syscalls, so a signal the guest has blocked can't interrupt a blocking syscall with EINTR.
+     * Only costs a host syscall when the guest blocked more signals since the last one.
+     */
+    void BlockHostSignalsForSyscall();
+
     /**
      * @brief Registers a signal handler for the host to handle a signal
      *
@@ -115,7 +131,6 @@ namespace FEX::HLE {
 
     struct SignalHandler {
       std::atomic<bool> Installed{};
-      std::atomic<bool> Required{};
       kernel_sigaction HostAction{};
       kernel_sigaction OldAction{};
       FEXCore::HostSignalDelegatorFunction Handler{};
@@ -129,6 +144,12 @@ namespace FEX::HLE {
     bool InstallHostThunk(int Signal);
     bool UpdateHostThunk(int Signal);
 
+    // Signals FEX needs for itself, these can never be blocked on the host
+    std::atomic<uint64_t> RequiredSignalsMask{};
+    // Signals that go through our thunk, only these can be blocked lazily
+    std::atomic<uint64_t> InstalledSignalsMask{};
+    void SetRequired(int Signal, bool Required);
+
     std::mutex HostDelegatorMutex;
     std::mutex GuestDelegatorMutex;
 
@@ -17,8 +17,11 @@ $end_info$
 
 #include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/Core/CodeLoader.h>
+#include <FEXCore/Core/CoreState.h>
 #include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/Utils/Allocator.h>
+#include <algorithm>
+#include <cstring>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
@@ -133,6 +136,9 @@ uint64_t ExecveHandler(const char *pathname, std::vector<const char*> &argv, std
     Filename = FEX::HLE::_SyscallHandler->Filename();
   }
 
+  // The new image inherits the host signal mask, make sure it is the guest's
+  FEX::HLE::_SyscallHandler->GetSignalDelegator()->SyncHostSignalMask();
+
   uint64_t Result{};
   if (FEX::HLE::_SyscallHandler->IsInterpreterInstalled()) {
     // If the FEX interpreter is installed then just execve the thing
@@ -275,10 +281,8 @@ uint64_t CloneHandler(FEXCore::Core::CpuStateFrame *Frame, FEX::HLE::clone3_args
   if (!(flags & CLONE_THREAD)) {
 
     if (flags & CLONE_VFORK) {
-      PrintFlags(flags);
-      flags &= ~CLONE_VFORK;
+      // The child gets a copy of the address space, ForkGuest still suspends the parent until execve or exit
       flags &= ~CLONE_VM;
-      LogMan::Msg::D("clone: WARNING: CLONE_VFORK w/o CLONE_THREAD");
     }
 
     if (AnyFlagsSet(flags, CLONE_SYSVSEM | CLONE_FS |  CLONE_FILES | CLONE_SIGHAND | CLONE_VM)) {
@@ -342,20 +346,10 @@ uint64_t SyscallHandler::HandleBRK(FEXCore::Core::CpuStateFrame *Frame, void *Ad
     else {
       uint64_t NewSize = NewEnd - DataSpace;
       uint64_t NewSizeAligned = AlignUp(NewSize, 4096);
+      uint64_t OldSizeAligned = AlignUp(DataSpaceSize, 4096);
 
-      if (NewSizeAligned < DataSpaceMaxSize) {
-        // If we are shrinking the brk then munmap the ranges
-        // That way we gain the memory back and also give the application zero pages if it allocates again
-        // DataspaceMaxSize is always page aligned
-
-        uint64_t RemainingSize = DataSpaceMaxSize - NewSizeAligned;
-        // We have pages we can unmap
-        FEXCore::Allocator::munmap(reinterpret_cast<void*>(DataSpace + NewSizeAligned), RemainingSize);
-        DataSpaceMaxSize = NewSizeAligned;
-      }
-      else if (NewSize > DataSpaceMaxSize) {
-        constexpr static uint64_t SizeAlignment = 8 * 1024 * 1024;
-        uint64_t AllocateNewSize = AlignUp(NewSize, SizeAlignment) - DataSpaceMaxSize;
+      if (NewSize > DataSpaceMaxSize) {
+        uint64_t AllocateNewSize = AlignUp(NewSize, BRK_COMMIT_ALIGNMENT) - DataSpaceMaxSize;
         if (!Is64BitMode() &&
           (DataSpace + DataSpaceMaxSize + AllocateNewSize > 0x1'0000'0000ULL)) {
           // If we are 32bit and we tried going about the 32bit limit then out of memory
@@ -391,6 +385,46 @@ uint64_t SyscallHandler::HandleBRK(FEXCore::Core::CpuStateFrame *Frame, void *Ad
         else {
           // Increase our BRK size
           DataSpaceMaxSize += AllocateNewSize;
+
+          if (DataSpaceMaxSize >= BRK_HUGEPAGE_THRESHOLD) {
+            // Large heaps get THP, the commit steps are already huge page multiples
+            ::madvise(reinterpret_cast<void*>(DataSpace), DataSpaceMaxSize, MADV_HUGEPAGE);
+          }
+        }
+      }
+
+      if (NewSizeAligned > OldSizeAligned) {
+        // Pages that were in use before a shrink still hold the guest's old data.
+        // The kernel hands out zero pages when brk grows and glibc relies on that for calloc.
+        uint64_t ZeroEnd = std::min(NewSizeAligned, DataSpaceDirtySize);
+        if (ZeroEnd > OldSizeAligned) {
+          auto ZeroBase = reinterpret_cast<void*>(DataSpace + OldSizeAligned);
+          uint64_t ZeroSize = ZeroEnd - OldSizeAligned;
+          if (ZeroSize <= BRK_ZERO_MEMSET_LIMIT) {
+            memset(ZeroBase, 0, ZeroSize);
+          }
+          else {
+            ::madvise(ZeroBase, ZeroSize, MADV_DONTNEED);
+          }
+        }
+
+        DataSpaceDirtySize = std::max(DataSpaceDirtySize, NewSizeAligned);
+        DataSpaceReleasedSize = std::max(DataSpaceReleasedSize, NewSizeAligned);
+      }
+      else if (NewSizeAligned < OldSizeAligned) {
+        // Shrinking keeps the pages mapped so a regrow doesn't need to mmap again.
+        // Only hand pages back once they are well past the break, so a guest that
+        // trims and grows around the same size doesn't pay for refaulting them.
+        uint64_t ReleaseStart = NewSizeAligned + BRK_RELEASE_HYSTERESIS;
+        if (DataSpaceReleasedSize > ReleaseStart &&
+            (DataSpaceReleasedSize - ReleaseStart) >= BRK_RELEASE_HYSTERESIS) {
+          auto ReleaseBase = reinterpret_cast<void*>(DataSpace + ReleaseStart);
+          uint64_t ReleaseSize = DataSpaceReleasedSize - ReleaseStart;
+          if (::madvise(ReleaseBase, ReleaseSize, MADV_FREE) == -1) {
+            // MADV_FREE is 4.5+
+            ::madvise(ReleaseBase, ReleaseSize, MADV_DONTNEED);
+          }
+          DataSpaceReleasedSize = ReleaseStart;
         }
       }
 
@@ -407,6 +441,101 @@ void SyscallHandler::DefaultProgramBreak(uint64_t Base, uint64_t Size) {
   DataSpaceStartingSize = Size;
 }
 
+uint64_t SyscallHandler::DeterministicNanoseconds(FEXCore::Core::CpuStateFrame *Frame) {
+  static_assert(FEXCore::Core::VIRTUAL_TSC_FREQUENCY == 1'000'000'000, "Virtual TSC is expected to tick in nanoseconds");
+
+  // Each thread counts its own instructions, keep time moving forward when a slower thread asks
+  uint64_t Now = Frame->State.VirtualTSC;
+  uint64_t Last = LastDeterministicTime.load();
+  uint64_t Result{};
+  do {
+    Result = std::max(Now, Last + 1);
+  } while (!LastDeterministicTime.compare_exchange_weak(Last, Result));
+
+  return Result;
+}
+
+int SyscallHandler::ClockGetTime(FEXCore::Core::CpuStateFrame *Frame, clockid_t ClockID, struct timespec *tp) {
+  if (!Deterministic) {
+    return ::clock_gettime(ClockID, tp);
+  }
+
+  // Let the host reject clocks that don't exist
+  if (::clock_getres(ClockID, nullptr) == -1) {
+    return -1;
+  }
+
+  if (!tp) {
+    errno = EFAULT;
+    return -1;
+  }
+
+  // Wall clocks start from a fixed date instead of the host's
+  constexpr uint64_t DeterministicEpoch = 1'600'000'000;
+  uint64_t Nanoseconds = DeterministicNanoseconds(Frame);
+  tp->tv_sec = Nanoseconds / 1'000'000'000;
+  tp->tv_nsec = Nanoseconds % 1'000'000'000;
+
+  if (ClockID == CLOCK_REALTIME ||
+      ClockID == CLOCK_REALTIME_COARSE ||
+      ClockID == CLOCK_TAI) {
+    tp->tv_sec += DeterministicEpoch;
+  }
+
+  return 0;
+}
+
+int SyscallHandler::GetTimeOfDay(FEXCore::Core::CpuStateFrame *Frame, struct timeval *tv, struct timezone *tz) {
+  if (!Deterministic) {
+    return ::gettimeofday(tv, tz);
+  }
+
+  if (tz && ::gettimeofday(nullptr, tz) == -1) {
+    return -1;
+  }
+
+  if (tv) {
+    struct timespec tp{};
+    ClockGetTime(Frame, CLOCK_REALTIME, &tp);
+    tv->tv_sec = tp.tv_sec;
+    tv->tv_usec = tp.tv_nsec / 1000;
+  }
+
+  return 0;
+}
+
+time_t SyscallHandler::Time(FEXCore::Core::CpuStateFrame *Frame, time_t *tloc) {
+  if (!Deterministic) {
+    return ::time(tloc);
+  }
+
+  struct timespec tp{};
+  ClockGetTime(Frame, CLOCK_REALTIME, &tp);
+  if (tloc) {
+    *tloc = tp.tv_sec;
+  }
+  return tp.tv_sec;
+}
+
+ssize_t SyscallHandler::GetRandom(void *buf, size_t buflen, unsigned int flags) {
+  if (!Deterministic) {
+    return ::getrandom(buf, buflen, flags);
+  }
+
+  // splitmix64 from a fixed seed, the same run always sees the same bytes
+  std::lock_guard lk(RandomMutex);
+  auto Data = reinterpret_cast<uint8_t*>(buf);
+  for (size_t i = 0; i < buflen; i += sizeof(uint64_t)) {
+    uint64_t z = (RandomState += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    memcpy(&Data[i], &z, std::min(buflen - i, sizeof(uint64_t)));
+  }
+
+  return buflen;
+}
+
 SyscallHandler::SyscallHandler(FEXCore::Context::Context *ctx, FEX::HLE::SignalDelegator *_SignalDelegation)
   : FM {ctx}
   , SignalDelegation {_SignalDelegation} {
@@ -450,6 +579,13 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::CpuStateFrame *Frame, FEXC
   }
 
   auto &Def = Definitions[Args->Argument[0]];
+
+  // The host mask trails the guest's, catch it up so a signal the guest blocked can't interrupt the syscall.
+  // Mask only syscalls skip it, otherwise a lazy block followed by an unblock costs two host syscalls again
+  if (!Def.SkipHostMaskSync) {
+    SignalDelegation->BlockHostSignalsForSyscall();
+  }
+
   uint64_t Result{};
   switch (Def.NumArgs) {
   case 0: Result = std::invoke(Def.Ptr0, Frame); break;
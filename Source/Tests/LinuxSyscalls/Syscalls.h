@@ -21,6 +21,8 @@ $end_info$
 #include <unordered_map>
 
 #include <sys/epoll.h>
+#include <sys/time.h>
+#include <time.h>
 #include <fcntl.h>
 
 // #define DEBUG_STRACE
@@ -82,6 +84,8 @@ public:
 
   struct SyscallFunctionDefinition {
     uint8_t NumArgs;
+    // Only touches the signal mask or dispositions and never waits, so the host mask doesn't need to catch up first
+    bool SkipHostMaskSync{};
     union {
       void* Ptr;
       SyscallPtrArg0 Ptr0;
@@ -108,6 +112,12 @@ public:
 
   uint64_t HandleBRK(FEXCore::Core::CpuStateFrame *Frame, void *Addr);
 
+  // Time and entropy sources, derived from the guest TSC and a fixed seed in deterministic mode
+  int ClockGetTime(FEXCore::Core::CpuStateFrame *Frame, clockid_t ClockID, struct timespec *tp);
+  int GetTimeOfDay(FEXCore::Core::CpuStateFrame *Frame, struct timeval *tv, struct timezone *tz);
+  time_t Time(FEXCore::Core::CpuStateFrame *Frame, time_t *tloc);
+  ssize_t GetRandom(void *buf, size_t buflen, unsigned int flags);
+
   FEX::HLE::FileManager FM;
   FEXCore::CodeLoader *GetCodeLoader() const { return LocalLoader; }
   void SetCodeLoader(FEXCore::CodeLoader *Loader) { LocalLoader = Loader; }
@@ -119,6 +129,7 @@ public:
   FEX_CONFIG_OPT(RootFSPath, ROOTFS);
   FEX_CONFIG_OPT(ThreadsConfig, THREADS);
   FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
+  FEX_CONFIG_OPT(Deterministic, DETERMINISTIC);
 
   uint32_t GetHostKernelVersion() const { return HostKernelVersion; }
   uint32_t GetGuestKernelVersion() const { return GuestKernelVersion; }
@@ -147,6 +158,18 @@ protected:
   uint64_t DataSpaceSize {};
   uint64_t DataSpaceMaxSize {};
   uint64_t DataSpaceStartingSize{};
+  // Pages below this may hold guest data and need zeroing before the break grows over them again
+  uint64_t DataSpaceDirtySize{};
+  // Pages from here up to DataSpaceDirtySize have already been given back to the kernel
+  uint64_t DataSpaceReleasedSize{};
+
+  // Committed brk grows in these steps and is never unmapped until exit
+  constexpr static uint64_t BRK_COMMIT_ALIGNMENT = 8 * 1024 * 1024;
+  // Unused pages above the break that are kept resident
+  constexpr static uint64_t BRK_RELEASE_HYSTERESIS = 8 * 1024 * 1024;
+  constexpr static uint64_t BRK_HUGEPAGE_THRESHOLD = 32 * 1024 * 1024;
+  // Regrowing over fewer dirty bytes than this is cheaper to memset than to refault
+  constexpr static uint64_t BRK_ZERO_MEMSET_LIMIT = 64 * 1024;
 
   // (Major << 24) | (Minor << 16) | Patch
   uint32_t HostKernelVersion{};
@@ -160,6 +183,13 @@ private:
   std::mutex SyscallMutex;
   FEXCore::CodeLoader *LocalLoader{};
 
+  // Guest nanoseconds since startup in deterministic mode, never goes backwards across threads
+  uint64_t DeterministicNanoseconds(FEXCore::Core::CpuStateFrame *Frame);
+  std::atomic<uint64_t> LastDeterministicTime{};
+
+  std::mutex RandomMutex;
+  uint64_t RandomState{0x4645582d45585f31ULL};
+
   #ifdef DEBUG_STRACE
     void Strace(FEXCore::HLE::SyscallArguments *Args, uint64_t Ret);
   #endif
@@ -72,7 +72,7 @@ namespace FEX::HLE {
     });
 
     REGISTER_SYSCALL_IMPL(getrandom, [](FEXCore::Core::CpuStateFrame *Frame, void *buf, size_t buflen, unsigned int flags) -> uint64_t {
-      uint64_t Result = ::getrandom(buf, buflen, flags);
+      uint64_t Result = FEX::HLE::_SyscallHandler->GetRandom(buf, buflen, flags);
       SYSCALL_ERRNO();
     });
 
@@ -15,6 +15,7 @@ $end_info$
 #include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/Debug/InternalThreadState.h>
 
+#include <fcntl.h>
 #include <grp.h>
 #include <limits.h>
 #include <linux/futex.h>
@@ -44,6 +45,9 @@ namespace FEX::HLE {
     NewThreadState.gregs[FEXCore::X86State::REG_RBP] = 0;
     NewThreadState.gregs[FEXCore::X86State::REG_RSP] = args->stack;
 
+    // The new thread picks up its guest signal mask from the host mask it inherits
+    FEX::HLE::_SyscallHandler->GetSignalDelegator()->SyncHostSignalMask();
+
     auto NewThread = FEXCore::Context::CreateThread(CTX, &NewThreadState, args->parent_tid);
     FEXCore::Context::InitializeThread(CTX, NewThread);
 
@@ -98,10 +102,26 @@ namespace FEX::HLE {
   }
 
   uint64_t ForkGuest(FEXCore::Core::InternalThreadState *Thread, FEXCore::Core::CpuStateFrame *Frame, uint32_t flags, void *stack, pid_t *parent_tid, pid_t *child_tid, void *tls) {
+    // vfork suspends the parent until the child calls execve or exits
+    // The child can't share our address space since the JIT state isn't safe to use from two processes at once.
+    // Instead the child holds the write end of a CLOEXEC pipe that the parent waits on.
+    // With the parent asleep, the child doesn't race it on copy-on-write faults before the execve.
+    int VforkPipe[2] = {-1, -1};
+    bool IsVfork = flags & CLONE_VFORK;
+    if (IsVfork && pipe2(VforkPipe, O_CLOEXEC) == -1) {
+      // Fall back to regular fork behaviour
+      IsVfork = false;
+    }
+
     pid_t Result = fork();
 
     if (Result == 0) {
       // Child
+      if (IsVfork) {
+        // Write end gets closed on execve or exit, which wakes the parent
+        close(VforkPipe[0]);
+      }
+
       // update the internal TID
       Thread->ThreadManager.TID = ::gettid();
       Thread->ThreadManager.PID = ::getpid();
@@ -149,12 +169,27 @@ namespace FEX::HLE {
       // the rest of the context remains as is, this thread will keep executing
       return 0;
     } else {
+      int ForkErrno = errno;
+
+      if (IsVfork) {
+        close(VforkPipe[1]);
+
+        if (Result != -1) {
+          // Wait for the child to execve or exit
+          char Byte;
+          while (read(VforkPipe[0], &Byte, sizeof(Byte)) == -1 && errno == EINTR);
+        }
+
+        close(VforkPipe[0]);
+      }
+
       if (Result != -1) {
         if (flags & CLONE_PARENT_SETTID) {
           *parent_tid = Result;
         }
       }
       // Parent
+      errno = ForkErrno;
       SYSCALL_ERRNO();
     }
   }
@@ -170,7 +205,7 @@ namespace FEX::HLE {
     });
 
     REGISTER_SYSCALL_IMPL(vfork, [](FEXCore::Core::CpuStateFrame *Frame) -> uint64_t {
-      return ForkGuest(Frame->Thread, Frame, 0, 0, 0, 0, 0);
+      return ForkGuest(Frame->Thread, Frame, CLONE_VFORK, 0, 0, 0, 0);
     });
 
     REGISTER_SYSCALL_IMPL(clone3, ([](FEXCore::Core::CpuStateFrame *Frame, FEX::HLE::clone3_args *cl_args, size_t size) -> uint64_t {
@@ -25,7 +25,7 @@ namespace FEX::HLE {
     });
 
     REGISTER_SYSCALL_IMPL(time, [](FEXCore::Core::CpuStateFrame *Frame, time_t *tloc) -> uint64_t {
-      uint64_t Result = ::time(tloc);
+      uint64_t Result = FEX::HLE::_SyscallHandler->Time(Frame, tloc);
       SYSCALL_ERRNO();
     });
 
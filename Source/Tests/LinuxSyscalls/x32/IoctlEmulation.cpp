@@ -16,8 +16,10 @@
 
 #include <FEXCore/Utils/LogManager.h>
 
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <functional>
+#include <vector>
 extern "C" {
 #include <drm/drm.h>
 #include <drm/msm_drm.h>
@@ -37,325 +39,150 @@ namespace FEX::HLE::x32 {
     LogMan::Msg::A("@@@@@@@@@@@@@@@@@@@@@@@@@");
   }
 
+  using HandlerType = uint32_t(*)(int fd, uint32_t cmd, uint32_t args);
+
   namespace BasicHandler {
-    uint64_t BasicHandler(int fd, uint32_t cmd, uint32_t args) {
+    uint32_t BasicHandler(int fd, uint32_t cmd, uint32_t args) {
       uint64_t Result = ::ioctl(fd, cmd, args);
       SYSCALL_ERRNO();
     }
   }
 
-  namespace DRM {
-    uint32_t AddAndRunHandler(int fd, uint32_t cmd, uint32_t args);
-    void AssignDeviceTypeToFD(int fd, drm_version const &Version);
-
-    template <size_t LRUSize>
-    class LRUCacheFDCache {
-    public:
-      LRUCacheFDCache() {
-        // Set the last element to our handler
-        // This element will always be the last one
-        LRUCache[LRUSize] = std::make_pair(0, AddAndRunHandler);
-      }
-
-      using HandlerType = uint32_t(*)(int fd, uint32_t cmd, uint32_t args);
-      void SetFDHandler(uint32_t FD, HandlerType Handler) {
-        FDToHandler[FD] = Handler;
+  /**
+   * @brief Translates an ioctl that takes a single struct with a different 32bit layout
+   *
+   * The guest struct describes its layout and pointer fix-ups through its conversion operators,
+   * the direction bits of the host command decide if the result needs to be copied back.
+   */
+  template<uint32_t HostCmd, typename GuestType, typename HostType>
+  uint32_t StructHandler(int fd, uint32_t cmd, uint32_t args) {
+    GuestType *Guest = reinterpret_cast<GuestType*>(args);
+    HostType Host = *Guest;
+    uint64_t Result = ::ioctl(fd, HostCmd, &Host);
+    if constexpr ((_IOC_DIR(HostCmd) & _IOC_READ) != 0) {
+      if (Result != -1) {
+        *Guest = Host;
       }
+    }
+    SYSCALL_ERRNO();
+  }
 
-      void DuplicateFD(int fd, int NewFD) {
-        auto it = FDToHandler.find(fd);
-        if (it != FDToHandler.end()) {
-          FDToHandler[NewFD] = it->second;
-        }
-      }
+  // Per command descriptor table for one ioctl type, indexed by _IOC_NR
+  class CommandTable {
+  public:
+    CommandTable(const char *Name)
+      : Name {Name} {}
 
-      HandlerType FindHandler(uint32_t FD) {
-        HandlerType Handler{};
-        for (size_t i = 0; i < LRUSize; ++i) {
-          auto &it = LRUCache[i];
-          if (it.first == FD) {
-            if (i == 0) {
-              // If we are the first in the queue then just return it
-              return it.second;
-            }
-            Handler = it.second;
-            break;
-          }
-        }
+    void Set(uint32_t cmd, HandlerType Handler) {
+      Handlers[_IOC_NR(cmd)] = Handler;
+    }
 
-        if (Handler) {
-          AddToFront(FD, Handler);
-          return Handler;
-        }
-        return LRUCache[LRUSize].second;
+    void SetRange(uint32_t First, uint32_t Last, HandlerType Handler) {
+      for (uint32_t i = First; i <= Last; ++i) {
+        Handlers[i] = Handler;
       }
+    }
 
-      uint32_t AddAndRunMapHandler(int fd, uint32_t cmd, uint32_t args) {
-        // Couldn't find in cache, check map
-        {
-          auto it = FDToHandler.find(fd);
-          if (it != FDToHandler.end()) {
-            // Found, add to the cache
-            AddToFront(fd, it->second);
-            return it->second(fd, cmd, args);
-          }
-        }
+    uint32_t Run(int fd, uint32_t cmd, uint32_t args) const {
+      auto Handler = Handlers[_IOC_NR(cmd)];
+      if (!Handler) {
+        UnhandledIoctl(Name, fd, cmd, args);
+        return -EPERM;
+      }
+      return Handler(fd, cmd, args);
+    }
 
-        // Wasn't found in map, query it
-        drm_version Host_Version{};
-        Host_Version.name = reinterpret_cast<char*>(alloca(128));
-        Host_Version.name_len = 128;
-        uint64_t Result = ioctl(fd, DRM_IOCTL_VERSION, &Host_Version);
+  private:
+    const char *Name;
+    std::array<HandlerType, 1U << _IOC_NRBITS> Handlers{};
+  };
 
-        // Add it to the map and double check that it was added
-        // Next time around when the ioctl is used then it will be added to cache
-        if (Result != -1) {
-          AssignDeviceTypeToFD(fd, Host_Version);
+  namespace DRM {
+    static CommandTable Commands{"DRM"};
+    static CommandTable AMDGPUCommands{"AMDGPU"};
+    static CommandTable MSMCommands{"MSM"};
+    static CommandTable NouveauCommands{"Nouveau"};
+    static CommandTable I915Commands{"I915"};
+    static CommandTable PanfrostCommands{"Panfrost"};
+    static CommandTable LimaCommands{"Lima"};
+
+    // Flat fd indexed table of the device commands for each DRM fd
+    // Pages are allocated on first use and never freed so lookups don't need a lock
+    class FDDeviceTable {
+    public:
+      const CommandTable *Find(int fd) const {
+        if (fd < 0 || static_cast<size_t>(fd) >= MaxFD) {
+          return nullptr;
         }
 
-        auto it = FDToHandler.find(fd);
-
-        if (it == FDToHandler.end()) {
-          // We don't understand this DRM ioctl
-          return -EPERM;
+        auto FDPage = Pages[fd / PageEntries].load(std::memory_order_acquire);
+        if (!FDPage) {
+          return nullptr;
         }
-        Result = it->second(fd, cmd, args);
-        SYSCALL_ERRNO();
-      }
-
-    private:
-      void AddToFront(uint32_t FD, HandlerType Handler) {
-        // Push the element to the front if we found one
-        // First copy all the other elements back one
-        // Ensuring the final element isn't written over
-        memmove(&LRUCache[1], &LRUCache[0], (LRUSize - 1) * sizeof(LRUCache[0]));
-        // Now set the first element to the one we just found
-        LRUCache[0] = std::make_pair(FD, Handler);
+        return (*FDPage)[fd % PageEntries].load(std::memory_order_relaxed);
       }
-      // With four elements total (3 + 1) then this is a single cacheline in size
-      std::pair<uint32_t, HandlerType> LRUCache[LRUSize + 1];
-      std::map<uint32_t, HandlerType> FDToHandler;
-    };
-
-    static LRUCacheFDCache<3> FDToHandler;
-
-    uint32_t AddAndRunHandler(int fd, uint32_t cmd, uint32_t args) {
-      return FDToHandler.AddAndRunMapHandler(fd, cmd, args);
-    }
 
-    void CheckAndAddFDDuplication(int fd, int NewFD) {
-      FDToHandler.DuplicateFD(fd, NewFD);
-    }
-
-    uint32_t AMDGPU_Handler(int fd, uint32_t cmd, uint32_t args) {
-      switch (_IOC_NR(cmd)) {
-        case _IOC_NR(FEX_DRM_IOCTL_AMDGPU_GEM_METADATA): {
-          AMDGPU::fex_drm_amdgpu_gem_metadata *val = reinterpret_cast<AMDGPU::fex_drm_amdgpu_gem_metadata*>(args);
-          drm_amdgpu_gem_metadata Host_val = *val;
-          uint64_t Result = ioctl(fd, DRM_IOCTL_AMDGPU_GEM_METADATA, &Host_val);
-          if (Result != -1) {
-            *val = Host_val;
-          }
-          SYSCALL_ERRNO();
-          break;
+      void Set(int fd, const CommandTable *Table) {
+        if (fd < 0 || static_cast<size_t>(fd) >= MaxFD) {
+          // Past the table, these get queried on every ioctl
+          return;
         }
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
-#define _CUSTOM_META(name, ioctl_num)
-#define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
-#include "Tests/LinuxSyscalls/x32/Ioctl/amdgpu_drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
-        }
-        default:
-          UnhandledIoctl("AMDGPU", fd, cmd, args);
-          return -EPERM;
-          break;
-      }
-#undef _BASIC_META
-#undef _BASIC_META_VAR
-#undef _CUSTOM_META
-#undef _CUSTOM_META_OFFSET
-      return -EPERM;
-    }
 
-    uint32_t MSM_Handler(int fd, uint32_t cmd, uint32_t args) {
-      switch (_IOC_NR(cmd)) {
-        case _IOC_NR(FEX_DRM_IOCTL_MSM_WAIT_FENCE): {
-          MSM::fex_drm_msm_wait_fence *val = reinterpret_cast<MSM::fex_drm_msm_wait_fence*>(args);
-          drm_msm_wait_fence Host_val = *val;
-          uint64_t Result = ::ioctl(fd, DRM_IOCTL_MSM_WAIT_FENCE, &Host_val);
-          if (Result != -1) {
-            *val = Host_val;
+        auto &Slot = Pages[fd / PageEntries];
+        auto FDPage = Slot.load(std::memory_order_acquire);
+        if (!FDPage) {
+          auto NewPage = new Page{};
+          if (Slot.compare_exchange_strong(FDPage, NewPage, std::memory_order_acq_rel)) {
+            FDPage = NewPage;
+          }
+          else {
+            // Another thread beat us to it
+            delete NewPage;
           }
-          SYSCALL_ERRNO();
-          break;
         }
 
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
-#define _CUSTOM_META(name, ioctl_num)
-#define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
-#include "Tests/LinuxSyscalls/x32/Ioctl/msm_drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
-        }
-        default:
-          UnhandledIoctl("MSM", fd, cmd, args);
-          return -EPERM;
-          break;
+        (*FDPage)[fd % PageEntries].store(Table, std::memory_order_relaxed);
       }
-#undef _BASIC_META
-#undef _BASIC_META_VAR
-#undef _CUSTOM_META
-#undef _CUSTOM_META_OFFSET
-      return -EPERM;
-    }
 
-    uint32_t Nouveau_Handler(int fd, uint32_t cmd, uint32_t args) {
-      switch (_IOC_NR(cmd)) {
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
-#define _CUSTOM_META(name, ioctl_num)
-#define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
-#include "Tests/LinuxSyscalls/x32/Ioctl/nouveau_drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
+      void Duplicate(int fd, int NewFD) {
+        if (auto Table = Find(fd)) {
+          Set(NewFD, Table);
         }
-        default:
-          UnhandledIoctl("Nouveau", fd, cmd, args);
-          return -EPERM;
-          break;
       }
-#undef _BASIC_META
-#undef _BASIC_META_VAR
-#undef _CUSTOM_META
-#undef _CUSTOM_META_OFFSET
-      return -EPERM;
-    }
-
-    uint32_t I915_Handler(int fd, uint32_t cmd, uint32_t args) {
-#define SIMPLE(enum, type) case _IOC_NR(FEX_##enum): { \
-          I915::fex_##type *guest = reinterpret_cast<I915::fex_##type*>(args); \
-          type host = *guest; \
-          uint64_t Result = ::ioctl(fd, enum, &host); \
-          if (Result != -1) { \
-            *guest = host; \
-          } \
-          SYSCALL_ERRNO(); \
-          break; \
-        }
 
+    private:
+      // Matches the kernel's default fs.nr_open
+      constexpr static size_t MaxFD = 1U << 20;
+      constexpr static size_t PageEntries = 1024;
+      using Page = std::array<std::atomic<const CommandTable*>, PageEntries>;
+      std::array<std::atomic<Page*>, MaxFD / PageEntries> Pages{};
+    };
 
-      switch (_IOC_NR(cmd)) {
-        SIMPLE(DRM_IOCTL_I915_BATCHBUFFER, drm_i915_batchbuffer_t)
-        SIMPLE(DRM_IOCTL_I915_IRQ_EMIT, drm_i915_irq_emit_t)
-        SIMPLE(DRM_IOCTL_I915_GETPARAM, drm_i915_getparam_t)
-        SIMPLE(DRM_IOCTL_I915_ALLOC, drm_i915_mem_alloc_t)
-        SIMPLE(DRM_IOCTL_I915_CMDBUFFER, drm_i915_cmdbuffer_t)
-
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
-#define _CUSTOM_META(name, ioctl_num)
-#define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
-#include "Tests/LinuxSyscalls/x32/Ioctl/i915_drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
-        }
-        default:
-          UnhandledIoctl("I915", fd, cmd, args);
-          return -EPERM;
-          break;
-      }
-#undef SIMPLE
-#undef _BASIC_META
-#undef _BASIC_META_VAR
-#undef _CUSTOM_META
-#undef _CUSTOM_META_OFFSET
-      return -EPERM;
-    }
-
-    uint32_t Panfrost_Handler(int fd, uint32_t cmd, uint32_t args) {
-      switch (_IOC_NR(cmd)) {
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
-#define _CUSTOM_META(name, ioctl_num)
-#define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
-#include "Tests/LinuxSyscalls/x32/Ioctl/panfrost_drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
-        }
-        default:
-          UnhandledIoctl("Panfrost", fd, cmd, args);
-          return -EPERM;
-          break;
-      }
-#undef _BASIC_META
-#undef _BASIC_META_VAR
-#undef _CUSTOM_META
-#undef _CUSTOM_META_OFFSET
-      return -EPERM;
-    }
+    static FDDeviceTable FDToHandler;
 
-    uint32_t Lima_Handler(int fd, uint32_t cmd, uint32_t args) {
-      switch (_IOC_NR(cmd)) {
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
-#define _CUSTOM_META(name, ioctl_num)
-#define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
-#include "Tests/LinuxSyscalls/x32/Ioctl/lima_drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
-        }
-        default:
-          UnhandledIoctl("Lima", fd, cmd, args);
-          return -EPERM;
-          break;
-      }
-#undef _BASIC_META
-#undef _BASIC_META_VAR
-#undef _CUSTOM_META
-#undef _CUSTOM_META_OFFSET
-      return -EPERM;
+    void CheckAndAddFDDuplication(int fd, int NewFD) {
+      FDToHandler.Duplicate(fd, NewFD);
     }
 
     void AssignDeviceTypeToFD(int fd, drm_version const &Version) {
       if (Version.name) {
         if (strcmp(Version.name, "amdgpu") == 0) {
-          FDToHandler.SetFDHandler(fd, AMDGPU_Handler);
+          FDToHandler.Set(fd, &AMDGPUCommands);
         }
         else if (strcmp(Version.name, "msm") == 0) {
-          FDToHandler.SetFDHandler(fd, MSM_Handler);
+          FDToHandler.Set(fd, &MSMCommands);
         }
         else if (strcmp(Version.name, "nouveau") == 0) {
-          FDToHandler.SetFDHandler(fd, Nouveau_Handler);
+          FDToHandler.Set(fd, &NouveauCommands);
         }
         else if (strcmp(Version.name, "i915") == 0) {
-          FDToHandler.SetFDHandler(fd, I915_Handler);
+          FDToHandler.Set(fd, &I915Commands);
         }
         else if (strcmp(Version.name, "panfrost") == 0) {
-          FDToHandler.SetFDHandler(fd, Panfrost_Handler);
+          FDToHandler.Set(fd, &PanfrostCommands);
         }
         else if (strcmp(Version.name, "lima") == 0) {
-          FDToHandler.SetFDHandler(fd, Lima_Handler);
+          FDToHandler.Set(fd, &LimaCommands);
         }
         else {
           LogMan::Msg::E("Unknown DRM device: '%s'", Version.name);
@@ -363,113 +190,155 @@ namespace FEX::HLE::x32 {
       }
     }
 
-    uint32_t Handler(int fd, uint32_t cmd, uint32_t args) {
-#define SIMPLE(enum, type) case _IOC_NR(FEX_##enum): { \
-          DRM::fex_##type *guest = reinterpret_cast<DRM::fex_##type*>(args); \
-          type host = *guest; \
-          uint64_t Result = ::ioctl(fd, enum, &host); \
-          if (Result != -1) { \
-            *guest = host; \
-          } \
-          SYSCALL_ERRNO(); \
-          break; \
-        }
+    uint32_t VersionHandler(int fd, uint32_t cmd, uint32_t args) {
+      fex_drm_version *version = reinterpret_cast<fex_drm_version*>(args);
+      drm_version Host_Version = *version;
+      uint64_t Result = ::ioctl(fd, DRM_IOCTL_VERSION, &Host_Version);
+      if (Result != -1) {
+        *version = Host_Version;
+        AssignDeviceTypeToFD(fd, Host_Version);
+      }
+      SYSCALL_ERRNO();
+    }
 
-      switch (_IOC_NR(cmd)) {
-        case _IOC_NR(FEX_DRM_IOCTL_VERSION): {
-          fex_drm_version *version = reinterpret_cast<fex_drm_version*>(args);
-          drm_version Host_Version = *version;
-          uint64_t Result = ::ioctl(fd, DRM_IOCTL_VERSION, &Host_Version);
-          if (Result != -1) {
-            *version = Host_Version;
-            AssignDeviceTypeToFD(fd, Host_Version);
-          }
-          SYSCALL_ERRNO();
-          break;
+    uint32_t WaitVBlankHandler(int fd, uint32_t cmd, uint32_t args) {
+      fex_drm_wait_vblank *guest = reinterpret_cast<fex_drm_wait_vblank*>(args);
+      drm_wait_vblank Host{};
+      Host.request = guest->request;
+      uint64_t Result = ::ioctl(fd, DRM_IOCTL_WAIT_VBLANK, &Host);
+      if (Result != -1) {
+        guest->reply = Host.reply;
+      }
+      SYSCALL_ERRNO();
+    }
+
+    uint32_t DeviceHandler(int fd, uint32_t cmd, uint32_t args) {
+      // This is the space of the DRM device commands
+      auto Table = FDToHandler.Find(fd);
+      if (!Table) {
+        // First device ioctl on this fd, query the driver
+        drm_version Host_Version{};
+        Host_Version.name = reinterpret_cast<char*>(alloca(128));
+        Host_Version.name_len = 128;
+        uint64_t Result = ::ioctl(fd, DRM_IOCTL_VERSION, &Host_Version);
+        if (Result != -1) {
+          AssignDeviceTypeToFD(fd, Host_Version);
+          Table = FDToHandler.Find(fd);
         }
 
-        SIMPLE(DRM_IOCTL_GET_UNIQUE, drm_unique)
-        SIMPLE(DRM_IOCTL_GET_CLIENT, drm_client)
-        SIMPLE(DRM_IOCTL_GET_STATS, drm_stats)
-        SIMPLE(DRM_IOCTL_SET_UNIQUE, drm_unique)
-
-        SIMPLE(DRM_IOCTL_ADD_MAP, drm_map)
-        SIMPLE(DRM_IOCTL_ADD_BUFS, drm_buf_desc)
-        SIMPLE(DRM_IOCTL_MARK_BUFS, drm_buf_desc)
-        SIMPLE(DRM_IOCTL_INFO_BUFS, drm_buf_info)
-        SIMPLE(DRM_IOCTL_MAP_BUFS, drm_buf_map)
-        SIMPLE(DRM_IOCTL_FREE_BUFS, drm_buf_free)
-        SIMPLE(DRM_IOCTL_RM_MAP, drm_map)
-        SIMPLE(DRM_IOCTL_SET_SAREA_CTX, drm_ctx_priv_map)
-        SIMPLE(DRM_IOCTL_GET_SAREA_CTX, drm_ctx_priv_map)
-
-        SIMPLE(DRM_IOCTL_RES_CTX,     drm_ctx_res)
-        SIMPLE(DRM_IOCTL_DMA,         drm_dma)
-        SIMPLE(DRM_IOCTL_SG_ALLOC,    drm_scatter_gather)
-        SIMPLE(DRM_IOCTL_SG_FREE,     drm_scatter_gather)
-        SIMPLE(DRM_IOCTL_UPDATE_DRAW, drm_update_draw)
-        SIMPLE(DRM_IOCTL_MODE_GETPLANERESOURCES, drm_mode_get_plane_res)
-        SIMPLE(DRM_IOCTL_MODE_ADDFB2,            drm_mode_fb_cmd2)
-        SIMPLE(DRM_IOCTL_MODE_OBJ_GETPROPERTIES, drm_mode_obj_get_properties)
-        SIMPLE(DRM_IOCTL_MODE_OBJ_SETPROPERTY,   drm_mode_obj_set_property)
-        SIMPLE(DRM_IOCTL_MODE_GETFB2,            drm_mode_fb_cmd2)
-
-        case _IOC_NR(FEX_DRM_IOCTL_WAIT_VBLANK): {
-          fex_drm_wait_vblank *guest = reinterpret_cast<fex_drm_wait_vblank*>(args);
-          drm_wait_vblank Host{};
-          Host.request = guest->request;
-          uint64_t Result = ::ioctl(fd, DRM_IOCTL_VERSION, &Host);
-          if (Result != -1) {
-            guest->reply = Host.reply;
-          }
-          SYSCALL_ERRNO();
-          break;
+        if (!Table) {
+          // We don't understand this DRM ioctl
+          return -EPERM;
         }
-        // Passthrough
-#define _BASIC_META(x) case _IOC_NR(x):
-#define _BASIC_META_VAR(x, args...) case _IOC_NR(x):
+      }
+
+      return Table->Run(fd, cmd, args);
+    }
+
+    uint32_t Handler(int fd, uint32_t cmd, uint32_t args) {
+      return Commands.Run(fd, cmd, args);
+    }
+
+    void InitializeCommandTables() {
+      // Passthrough commands come straight from the ioctl descriptions
+#define _BASIC_META(x) Table.Set(x, FEX::HLE::x32::BasicHandler::BasicHandler);
+#define _BASIC_META_VAR(x, args...) Table.Set(x(args), FEX::HLE::x32::BasicHandler::BasicHandler);
 #define _CUSTOM_META(name, ioctl_num)
 #define _CUSTOM_META_OFFSET(name, ioctl_num, offset)
-      // DRM
+      {
+        auto &Table = Commands;
 #include "Tests/LinuxSyscalls/x32/Ioctl/drm.inl"
-        {
-          uint64_t Result = ::ioctl(fd, cmd, args);
-          SYSCALL_ERRNO();
-          break;
-        }
-
-        case DRM_COMMAND_BASE ... (DRM_COMMAND_END - 1): {
-          // This is the space of the DRM device commands
-          auto it = FDToHandler.FindHandler(fd);
-          return it(fd, cmd, args);
-        break;
-        }
-        default:
-          UnhandledIoctl("DRM", fd, cmd, args);
-          return -EPERM;
-          break;
       }
-#undef SIMPLE
+      {
+        auto &Table = AMDGPUCommands;
+#include "Tests/LinuxSyscalls/x32/Ioctl/amdgpu_drm.inl"
+      }
+      {
+        auto &Table = MSMCommands;
+#include "Tests/LinuxSyscalls/x32/Ioctl/msm_drm.inl"
+      }
+      {
+        auto &Table = NouveauCommands;
+#include "Tests/LinuxSyscalls/x32/Ioctl/nouveau_drm.inl"
+      }
+      {
+        auto &Table = I915Commands;
+#include "Tests/LinuxSyscalls/x32/Ioctl/i915_drm.inl"
+      }
+      {
+        auto &Table = PanfrostCommands;
+#include "Tests/LinuxSyscalls/x32/Ioctl/panfrost_drm.inl"
+      }
+      {
+        auto &Table = LimaCommands;
+#include "Tests/LinuxSyscalls/x32/Ioctl/lima_drm.inl"
+      }
 #undef _BASIC_META
 #undef _BASIC_META_VAR
 #undef _CUSTOM_META
 #undef _CUSTOM_META_OFFSET
 
-      return -EPERM;
+      // Commands that need their struct translated
+#define SIMPLE(Table, Namespace, enum, type) \
+      Table.Set(FEX_##enum, StructHandler<enum, Namespace::fex_##type, type>);
+
+      Commands.Set(FEX_DRM_IOCTL_VERSION, VersionHandler);
+      Commands.Set(FEX_DRM_IOCTL_WAIT_VBLANK, WaitVBlankHandler);
+
+      SIMPLE(Commands, DRM, DRM_IOCTL_GET_UNIQUE, drm_unique)
+      SIMPLE(Commands, DRM, DRM_IOCTL_GET_CLIENT, drm_client)
+      SIMPLE(Commands, DRM, DRM_IOCTL_GET_STATS, drm_stats)
+      SIMPLE(Commands, DRM, DRM_IOCTL_SET_UNIQUE, drm_unique)
+
+      SIMPLE(Commands, DRM, DRM_IOCTL_ADD_MAP, drm_map)
+      SIMPLE(Commands, DRM, DRM_IOCTL_ADD_BUFS, drm_buf_desc)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MARK_BUFS, drm_buf_desc)
+      SIMPLE(Commands, DRM, DRM_IOCTL_INFO_BUFS, drm_buf_info)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MAP_BUFS, drm_buf_map)
+      SIMPLE(Commands, DRM, DRM_IOCTL_FREE_BUFS, drm_buf_free)
+      SIMPLE(Commands, DRM, DRM_IOCTL_RM_MAP, drm_map)
+      SIMPLE(Commands, DRM, DRM_IOCTL_SET_SAREA_CTX, drm_ctx_priv_map)
+      SIMPLE(Commands, DRM, DRM_IOCTL_GET_SAREA_CTX, drm_ctx_priv_map)
+
+      SIMPLE(Commands, DRM, DRM_IOCTL_RES_CTX,     drm_ctx_res)
+      SIMPLE(Commands, DRM, DRM_IOCTL_DMA,         drm_dma)
+      SIMPLE(Commands, DRM, DRM_IOCTL_SG_ALLOC,    drm_scatter_gather)
+      SIMPLE(Commands, DRM, DRM_IOCTL_SG_FREE,     drm_scatter_gather)
+      SIMPLE(Commands, DRM, DRM_IOCTL_UPDATE_DRAW, drm_update_draw)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MODE_GETPLANERESOURCES, drm_mode_get_plane_res)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MODE_ADDFB2,            drm_mode_fb_cmd2)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MODE_OBJ_GETPROPERTIES, drm_mode_obj_get_properties)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MODE_OBJ_SETPROPERTY,   drm_mode_obj_set_property)
+      SIMPLE(Commands, DRM, DRM_IOCTL_MODE_GETFB2,            drm_mode_fb_cmd2)
+
+      Commands.SetRange(DRM_COMMAND_BASE, DRM_COMMAND_END - 1, DeviceHandler);
+
+      SIMPLE(AMDGPUCommands, AMDGPU, DRM_IOCTL_AMDGPU_GEM_METADATA, drm_amdgpu_gem_metadata)
+
+      SIMPLE(MSMCommands, MSM, DRM_IOCTL_MSM_WAIT_FENCE, drm_msm_wait_fence)
+
+      SIMPLE(I915Commands, I915, DRM_IOCTL_I915_BATCHBUFFER, drm_i915_batchbuffer_t)
+      SIMPLE(I915Commands, I915, DRM_IOCTL_I915_IRQ_EMIT, drm_i915_irq_emit_t)
+      SIMPLE(I915Commands, I915, DRM_IOCTL_I915_GETPARAM, drm_i915_getparam_t)
+      SIMPLE(I915Commands, I915, DRM_IOCTL_I915_ALLOC, drm_i915_mem_alloc_t)
+      SIMPLE(I915Commands, I915, DRM_IOCTL_I915_CMDBUFFER, drm_i915_cmdbuffer_t)
+#undef SIMPLE
     }
   }
 
   struct IoctlHandler {
     uint32_t Command;
-    std::function<uint32_t(int fd, uint32_t cmd, uint32_t args)> Handler;
+    HandlerType Handler;
   };
 
-  static std::vector<std::function<uint32_t(int fd, uint32_t cmd, uint32_t args)>> Handlers;
+  static std::array<HandlerType, 1U << _IOC_TYPEBITS> Handlers;
 
   void InitializeStaticIoctlHandlers() {
     using namespace DRM;
     using namespace sockios;
 
+    DRM::InitializeCommandTables();
+
     const std::vector<IoctlHandler> LocalHandlers = {{
 #define _BASIC_META(x) IoctlHandler{_IOC_TYPE(x), FEX::HLE::x32::BasicHandler::BasicHandler},
 #define _BASIC_META_VAR(x, args...) IoctlHandler{_IOC_TYPE(x(args)), FEX::HLE::x32::BasicHandler::BasicHandler},
@@ -516,7 +385,7 @@ namespace FEX::HLE::x32 {
 #undef _CUSTOM_META_OFFSET
     }};
 
-    Handlers.assign(1U << _IOC_TYPEBITS, FEX::HLE::x32::BasicHandler::BasicHandler);
+    Handlers.fill(FEX::HLE::x32::BasicHandler::BasicHandler);
 
     for (auto &Arg : LocalHandlers) {
       Handlers[Arg.Command] = Arg.Handler;
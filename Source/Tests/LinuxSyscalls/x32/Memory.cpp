@@ -38,6 +38,7 @@ namespace FEX::HLE::x32 {
           FEXCore::Context::AddNamedRegion(Thread->CTX, Result, length, offset, filename);
         }
         FEXCore::Context::FlushCodeRange(Thread, (uintptr_t)Result, length);
+        FEXCore::Context::NotifyGuestMappingChanged(Thread->CTX, Result, length);
       }
       return Result;
     });
@@ -54,6 +55,7 @@ namespace FEX::HLE::x32 {
           FEXCore::Context::AddNamedRegion(Thread->CTX, Result, length, pgoffset * 0x1000, filename);
         }
         FEXCore::Context::FlushCodeRange(Thread, (uintptr_t)Result, length);
+        FEXCore::Context::NotifyGuestMappingChanged(Thread->CTX, Result, length);
       }
 
       return Result;
@@ -66,6 +68,7 @@ namespace FEX::HLE::x32 {
       if (Result == 0) {
         FEXCore::Context::RemoveNamedRegion(Frame->Thread->CTX, (uintptr_t)addr, length);
         FEXCore::Context::FlushCodeRange(Frame->Thread, (uintptr_t)addr, length);
+        FEXCore::Context::NotifyGuestMappingChanged(Frame->Thread->CTX, (uintptr_t)addr, length);
       }
 
       return Result;
@@ -76,12 +79,21 @@ namespace FEX::HLE::x32 {
       if (Result != -1 && prot & PROT_EXEC) {
         FEXCore::Context::FlushCodeRange(Frame->Thread, (uintptr_t)addr, len);
       }
+      if (Result != -1) {
+        FEXCore::Context::NotifyGuestMappingChanged(Frame->Thread->CTX, (uintptr_t)addr, len);
+      }
       SYSCALL_ERRNO();
     });
 
     REGISTER_SYSCALL_IMPL_X32(mremap, [](FEXCore::Core::CpuStateFrame *Frame, void *old_address, size_t old_size, size_t new_size, int flags, void *new_address) -> uint64_t {
-      return reinterpret_cast<uint64_t>(static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+      auto Result = reinterpret_cast<uint64_t>(static_cast<FEX::HLE::x32::x32SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
         mremap(old_address, old_size, new_size, flags, new_address));
+
+      if (Result < -4096) {
+        FEXCore::Context::NotifyGuestMappingChanged(Frame->Thread->CTX, (uintptr_t)old_address, old_size);
+        FEXCore::Context::NotifyGuestMappingChanged(Frame->Thread->CTX, Result, new_size);
+      }
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X32(mlockall, [](FEXCore::Core::CpuStateFrame *Frame, int flags) -> uint64_t {
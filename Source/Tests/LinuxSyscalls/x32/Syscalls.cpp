@@ -717,6 +717,21 @@ public:
 #endif
     }
 
+    // These don't block, the host mask can keep trailing the guest's through them
+    for (auto Syscall : {
+      SYSCALL_x86_sigaction,
+      SYSCALL_x86_sgetmask,
+      SYSCALL_x86_ssetmask,
+      SYSCALL_x86_sigpending,
+      SYSCALL_x86_sigprocmask,
+      SYSCALL_x86_rt_sigaction,
+      SYSCALL_x86_rt_sigprocmask,
+      SYSCALL_x86_rt_sigpending,
+      SYSCALL_x86_sigaltstack,
+    }) {
+      Definitions.at(Syscall).SkipHostMaskSync = true;
+    }
+
 #if PRINT_MISSING_SYSCALLS
     for (auto &Syscall: SyscallNames) {
       if (Definitions[Syscall.first].Ptr == cvt(&UnimplementedSyscall)) {
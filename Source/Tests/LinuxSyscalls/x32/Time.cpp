@@ -28,7 +28,7 @@ namespace FEX::HLE::x32 {
         tv_ptr = &tv64;
       }
 
-      uint64_t Result = ::gettimeofday(tv_ptr, tz);
+      uint64_t Result = FEX::HLE::_SyscallHandler->GetTimeOfDay(Frame, tv_ptr, tz);
 
       if (tv) {
         *tv = tv64;
@@ -73,7 +73,7 @@ namespace FEX::HLE::x32 {
 
     REGISTER_SYSCALL_IMPL_X32(clock_gettime, [](FEXCore::Core::CpuStateFrame *Frame, clockid_t clk_id, timespec32 *tp) -> uint64_t {
       struct timespec tp64{};
-      uint64_t Result = ::clock_gettime(clk_id, &tp64);
+      uint64_t Result = FEX::HLE::_SyscallHandler->ClockGetTime(Frame, clk_id, &tp64);
       if (tp) {
         *tp = tp64;
       }
@@ -150,7 +150,7 @@ namespace FEX::HLE::x32 {
     });
 
     REGISTER_SYSCALL_IMPL_X32(clock_gettime64, [](FEXCore::Core::CpuStateFrame *Frame, clockid_t clk_id, timespec *tp) -> uint64_t {
-      uint64_t Result = ::clock_gettime(clk_id, tp);
+      uint64_t Result = FEX::HLE::_SyscallHandler->ClockGetTime(Frame, clk_id, tp);
       SYSCALL_ERRNO();
     });
 
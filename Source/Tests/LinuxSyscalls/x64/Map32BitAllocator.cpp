@@ -0,0 +1,389 @@
+/*
+$info$
+tags: LinuxSyscalls|syscalls-x86-64
+$end_info$
+*/
+
+#include "Common/MathUtils.h"
+#include "Tests/LinuxSyscalls/x64/Map32BitAllocator.h"
+
+#include <FEXCore/Utils/Allocator.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <sys/mman.h>
+
+#ifndef MREMAP_DONTUNMAP
+#define MREMAP_DONTUNMAP 4
+#endif
+
+namespace FEX::HLE::x64 {
+  constexpr int X86_64_MAP_32BIT = 0x40;
+
+  void *Map32BitAllocator::mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset) {
+#ifdef _M_ARM_64
+    if ((flags & X86_64_MAP_32BIT) && !(flags & (MAP_FIXED | MAP_FIXED_NOREPLACE))) {
+      // Remove the flag, it means something else to the host
+      flags &= ~X86_64_MAP_32BIT;
+
+      if (length == 0) {
+        return reinterpret_cast<void*>(-EINVAL);
+      }
+
+      TrackWindow();
+
+      std::scoped_lock<std::mutex> lk{AllocMutex};
+      if (WindowUnavailable) {
+        return MapLowHint(length, prot, flags, fd, offset);
+      }
+
+      uint64_t Pages = AlignUp(length, PAGE_SIZE) >> PAGE_SHIFT;
+      for (;;) {
+        uint64_t Page = Free.AllocateRange(Pages);
+        if (Page == 0) {
+          return reinterpret_cast<void*>(-ENOMEM);
+        }
+
+        void *Addr = reinterpret_cast<void*>(Page << PAGE_SHIFT);
+        void *MappedPtr = FEXCore::Allocator::mmap(Addr, length, prot, flags | MAP_FIXED_NOREPLACE, fd, offset);
+        if (MappedPtr == Addr) {
+          return MappedPtr;
+        }
+
+        if (MappedPtr != MAP_FAILED) {
+          // Kernel is too old to understand MAP_FIXED_NOREPLACE and treated it as a hint
+          FEXCore::Allocator::munmap(MappedPtr, length);
+          Free.ReleaseRange(Page, Pages);
+          WindowUnavailable = true;
+          return MapLowHint(length, prot, flags, fd, offset);
+        }
+
+        int Error = errno;
+        if (Error != EEXIST) {
+          Free.ReleaseRange(Page, Pages);
+          return reinterpret_cast<void*>(-Error);
+        }
+
+        // Something we don't track is in the way, like brk or one of our own allocations.
+        // Write off only the pages it covers and try the next fit
+        WriteOffOccupiedPages(Page, Pages);
+      }
+    }
+#endif
+
+    if (!WindowTracked.load()) {
+      void *MappedPtr = FEXCore::Allocator::mmap(addr, length, prot, flags, fd, offset);
+      if (MappedPtr == MAP_FAILED) {
+        return reinterpret_cast<void*>(-errno);
+      }
+      return MappedPtr;
+    }
+
+    std::scoped_lock<std::mutex> lk{AllocMutex};
+
+    // Nothing is reserved, so hints and fixed mappings in to the window go to the kernel as they are
+    void *MappedPtr = FEXCore::Allocator::mmap(addr, length, prot, flags, fd, offset);
+    if (MappedPtr == MAP_FAILED) {
+      return reinterpret_cast<void*>(-errno);
+    }
+
+    uint64_t Page = reinterpret_cast<uint64_t>(MappedPtr) >> PAGE_SHIFT;
+    uint64_t Pages = AlignUp(length, PAGE_SIZE) >> PAGE_SHIFT;
+    if (ClampToWindow(Page, Pages)) {
+      Free.ClaimRange(Page, Pages);
+    }
+
+    return MappedPtr;
+  }
+
+  int Map32BitAllocator::munmap(void *addr, size_t length) {
+    if (!WindowTracked.load()) {
+      int Result = FEXCore::Allocator::munmap(addr, length);
+      return Result == -1 ? -errno : 0;
+    }
+
+    std::scoped_lock<std::mutex> lk{AllocMutex};
+
+    if (FEXCore::Allocator::munmap(addr, length) == -1) {
+      return -errno;
+    }
+
+    uint64_t Page = reinterpret_cast<uint64_t>(addr) >> PAGE_SHIFT;
+    uint64_t Pages = AlignUp(length, PAGE_SIZE) >> PAGE_SHIFT;
+    if (ClampToWindow(Page, Pages)) {
+      Free.ReleaseRange(Page, Pages);
+    }
+
+    return 0;
+  }
+
+  void *Map32BitAllocator::mremap(void *old_address, size_t old_size, size_t new_size, int flags, void *new_address) {
+    if (!WindowTracked.load()) {
+      void *MappedPtr = ::mremap(old_address, old_size, new_size, flags, new_address);
+      if (MappedPtr == MAP_FAILED) {
+        return reinterpret_cast<void*>(-errno);
+      }
+      return MappedPtr;
+    }
+
+    uint64_t OldAddr = reinterpret_cast<uint64_t>(old_address);
+    uint64_t OldPage = OldAddr >> PAGE_SHIFT;
+    uint64_t OldPages = AlignUp(old_size, PAGE_SIZE) >> PAGE_SHIFT;
+    uint64_t NewPages = AlignUp(new_size, PAGE_SIZE) >> PAGE_SHIFT;
+
+    std::scoped_lock<std::mutex> lk{AllocMutex};
+
+    bool OldInWindow = !(OldAddr & PAGE_MASK) &&
+      OldAddr >= WINDOW_BASE &&
+      (OldAddr + (OldPages << PAGE_SHIFT)) <= WINDOW_END;
+
+    // The kernel would move a growing mapping wherever it likes, keep it in the window instead
+    if (OldInWindow && !WindowUnavailable && OldPages && NewPages > OldPages &&
+        (flags & MREMAP_MAYMOVE) && !(flags & (MREMAP_FIXED | MREMAP_DONTUNMAP))) {
+      void *MappedPtr = ::mremap(old_address, old_size, new_size, 0);
+      if (MappedPtr != MAP_FAILED) {
+        Free.ClaimRange(OldPage + OldPages, NewPages - OldPages);
+        return MappedPtr;
+      }
+
+      for (;;) {
+        uint64_t NewPage = Free.AllocateRange(NewPages);
+        if (NewPage == 0) {
+          return reinterpret_cast<void*>(-ENOMEM);
+        }
+
+        // MREMAP_FIXED replaces whatever is at the destination, make sure that is only our placeholder
+        int Error = ReservePages(NewPage, NewPages);
+        if (Error == EEXIST) {
+          WriteOffOccupiedPages(NewPage, NewPages);
+          continue;
+        }
+
+        if (Error) {
+          // Can't place it safely, let the host move it
+          Free.ReleaseRange(NewPage, NewPages);
+          break;
+        }
+
+        MappedPtr = ::mremap(old_address, old_size, new_size, MREMAP_MAYMOVE | MREMAP_FIXED, reinterpret_cast<void*>(NewPage << PAGE_SHIFT));
+        if (MappedPtr == MAP_FAILED) {
+          Error = errno;
+          FEXCore::Allocator::munmap(reinterpret_cast<void*>(NewPage << PAGE_SHIFT), NewPages << PAGE_SHIFT);
+          Free.ReleaseRange(NewPage, NewPages);
+          return reinterpret_cast<void*>(-Error);
+        }
+
+        Free.ReleaseRange(OldPage, OldPages);
+        return MappedPtr;
+      }
+    }
+
+    // Everything else goes to the host, then the tracking catches up with what it did
+    void *MappedPtr = ::mremap(old_address, old_size, new_size, flags, new_address);
+    if (MappedPtr == MAP_FAILED) {
+      return reinterpret_cast<void*>(-errno);
+    }
+
+    uint64_t FreedPage{};
+    uint64_t FreedPages{};
+    if (MappedPtr != old_address) {
+      if (!(flags & MREMAP_DONTUNMAP)) {
+        FreedPage = OldPage;
+        FreedPages = OldPages;
+      }
+    }
+    else if (NewPages < OldPages) {
+      FreedPage = OldPage + NewPages;
+      FreedPages = OldPages - NewPages;
+    }
+
+    if (FreedPages && !(OldAddr & PAGE_MASK) && ClampToWindow(FreedPage, FreedPages)) {
+      Free.ReleaseRange(FreedPage, FreedPages);
+    }
+
+    uint64_t NewPage = reinterpret_cast<uint64_t>(MappedPtr) >> PAGE_SHIFT;
+    if (ClampToWindow(NewPage, NewPages)) {
+      Free.ClaimRange(NewPage, NewPages);
+    }
+
+    return MappedPtr;
+  }
+
+  void Map32BitAllocator::TrackWindow() {
+    if (WindowTracked.load()) {
+      return;
+    }
+
+    std::scoped_lock<std::mutex> lk{AllocMutex};
+    if (WindowTracked.load()) {
+      return;
+    }
+
+    // Anything already living in the window is found when a mapping runs in to it
+    Free.ReleaseRange(BASE_PAGE, END_PAGE - BASE_PAGE);
+    WindowTracked = true;
+  }
+
+  void *Map32BitAllocator::MapLowHint(size_t length, int prot, int flags, int fd, off_t offset) {
+    // Set address to a low address to force the kernel to allocate bottom up
+    void *MappedPtr = FEXCore::Allocator::mmap(reinterpret_cast<void*>(0x1'0000), length, prot, flags, fd, offset);
+    if (MappedPtr == MAP_FAILED) {
+      return reinterpret_cast<void*>(-errno);
+    }
+
+    if ((reinterpret_cast<uint64_t>(MappedPtr) + length) >= 0x1'0000'0000ULL) {
+      FEXCore::Allocator::munmap(MappedPtr, length);
+      return reinterpret_cast<void*>(-ENOMEM);
+    }
+
+    uint64_t Page = reinterpret_cast<uint64_t>(MappedPtr) >> PAGE_SHIFT;
+    uint64_t Pages = AlignUp(length, PAGE_SIZE) >> PAGE_SHIFT;
+    if (ClampToWindow(Page, Pages)) {
+      Free.ClaimRange(Page, Pages);
+    }
+
+    return MappedPtr;
+  }
+
+  int Map32BitAllocator::ReservePages(uint64_t Page, uint64_t Pages) {
+    void *Addr = reinterpret_cast<void*>(Page << PAGE_SHIFT);
+    void *MappedPtr = FEXCore::Allocator::mmap(Addr, Pages << PAGE_SHIFT, PROT_NONE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (MappedPtr == MAP_FAILED) {
+      return errno;
+    }
+
+    if (MappedPtr != Addr) {
+      // Kernel is too old to understand MAP_FIXED_NOREPLACE and treated it as a hint
+      FEXCore::Allocator::munmap(MappedPtr, Pages << PAGE_SHIFT);
+      return EOPNOTSUPP;
+    }
+
+    return 0;
+  }
+
+  void Map32BitAllocator::WriteOffOccupiedPages(uint64_t Page, uint64_t Pages) {
+    Free.ReleaseRange(Page, Pages);
+
+    if (!ClaimOccupiedPages(Page, Pages)) {
+      // Whatever was in the way couldn't be found, keep the whole range out of the next fit
+      Free.ClaimRange(Page, Pages);
+    }
+  }
+
+  bool Map32BitAllocator::ClaimOccupiedPages(uint64_t Page, uint64_t Pages) {
+    int Error = ReservePages(Page, Pages);
+    if (Error == 0) {
+      FEXCore::Allocator::munmap(reinterpret_cast<void*>(Page << PAGE_SHIFT), Pages << PAGE_SHIFT);
+      return false;
+    }
+
+    if (Error != EEXIST) {
+      return false;
+    }
+
+    if (Pages == 1) {
+      Free.ClaimRange(Page, 1);
+      return true;
+    }
+
+    uint64_t Half = Pages / 2;
+    bool Claimed = ClaimOccupiedPages(Page, Half);
+    Claimed |= ClaimOccupiedPages(Page + Half, Pages - Half);
+    return Claimed;
+  }
+
+  uint64_t FreePageRanges::AllocateRange(uint64_t Pages) {
+    // Best fit, lowest address among equal sizes
+    auto it = FreeBySize.lower_bound({Pages, 0});
+    if (it == FreeBySize.end()) {
+      return 0;
+    }
+
+    uint64_t Page = it->second;
+    uint64_t Size = it->first;
+    EraseFree(FreeByPage.find(Page));
+    if (Size > Pages) {
+      InsertFree(Page + Pages, Size - Pages);
+    }
+    return Page;
+  }
+
+  void FreePageRanges::ClaimRange(uint64_t Page, uint64_t Pages) {
+    uint64_t End = Page + Pages;
+
+    auto it = FreeByPage.upper_bound(Page);
+    if (it != FreeByPage.begin() && (std::prev(it)->first + std::prev(it)->second) > Page) {
+      --it;
+    }
+
+    while (it != FreeByPage.end() && it->first < End) {
+      uint64_t RangeStart = it->first;
+      uint64_t RangeEnd = RangeStart + it->second;
+      it = EraseFree(it);
+
+      if (RangeStart < Page) {
+        InsertFree(RangeStart, Page - RangeStart);
+      }
+      if (RangeEnd > End) {
+        InsertFree(End, RangeEnd - End);
+      }
+    }
+  }
+
+  void FreePageRanges::ReleaseRange(uint64_t Page, uint64_t Pages) {
+    ClaimRange(Page, Pages);
+
+    uint64_t Start = Page;
+    uint64_t End = Page + Pages;
+
+    auto Next = FreeByPage.find(End);
+    if (Next != FreeByPage.end()) {
+      End += Next->second;
+      EraseFree(Next);
+    }
+
+    auto Prev = FreeByPage.lower_bound(Page);
+    if (Prev != FreeByPage.begin()) {
+      --Prev;
+      if ((Prev->first + Prev->second) == Page) {
+        Start = Prev->first;
+        EraseFree(Prev);
+      }
+    }
+
+    InsertFree(Start, End - Start);
+  }
+
+  bool FreePageRanges::IsRangeFree(uint64_t Page, uint64_t Pages) const {
+    auto it = FreeByPage.upper_bound(Page);
+    if (it == FreeByPage.begin()) {
+      return false;
+    }
+    --it;
+    return (it->first + it->second) >= (Page + Pages);
+  }
+
+  void FreePageRanges::InsertFree(uint64_t Page, uint64_t Pages) {
+    FreeByPage.emplace(Page, Pages);
+    FreeBySize.emplace(Pages, Page);
+  }
+
+  std::map<uint64_t, uint64_t>::iterator FreePageRanges::EraseFree(std::map<uint64_t, uint64_t>::iterator it) {
+    FreeBySize.erase({it->second, it->first});
+    return FreeByPage.erase(it);
+  }
+
+  bool Map32BitAllocator::ClampToWindow(uint64_t &Page, uint64_t &Pages) {
+    uint64_t Start = std::max(Page, BASE_PAGE);
+    uint64_t End = std::min(Page + Pages, END_PAGE);
+    if (Start >= End) {
+      return false;
+    }
+
+    Page = Start;
+    Pages = End - Start;
+    return true;
+  }
+}
@@ -0,0 +1,98 @@
+/*
+$info$
+tags: LinuxSyscalls|syscalls-x86-64
+desc: Low memory allocator backing MAP_32BIT on hosts that don't have it
+$end_info$
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sys/types.h>
+
+namespace FEX::HLE::x64 {
+/**
+ * @brief Free page ranges, indexed both by address and by size
+ *
+ * Placement is a best fit lookup and freeing merges with the neighbouring ranges, both O(log n).
+ * Page zero is never handed out, it is used as the failure value.
+ */
+class FreePageRanges final {
+public:
+  // Returns the first page of a free range that fits, or zero
+  uint64_t AllocateRange(uint64_t Pages);
+  // Marks pages as in use, they don't need to be free
+  void ClaimRange(uint64_t Page, uint64_t Pages);
+  // Marks pages as free, merging with the neighbouring free ranges
+  void ReleaseRange(uint64_t Page, uint64_t Pages);
+  bool IsRangeFree(uint64_t Page, uint64_t Pages) const;
+
+  size_t NumRanges() const { return FreeByPage.size(); }
+
+private:
+  void InsertFree(uint64_t Page, uint64_t Pages);
+  std::map<uint64_t, uint64_t>::iterator EraseFree(std::map<uint64_t, uint64_t>::iterator it);
+
+  // First page -> number of pages
+  std::map<uint64_t, uint64_t> FreeByPage{};
+  // {Number of pages, first page}, ordered for best fit lookups
+  std::set<std::pair<uint64_t, uint64_t>> FreeBySize{};
+};
+
+/**
+ * @brief Serves MAP_32BIT requests out of the low 2GB
+ *
+ * Nothing is reserved up front. The window is only tracked, starting out as all free the first time a guest asks
+ * for MAP_32BIT, so guest hints, brk and /proc/self/maps all see the address space as the guest left it.
+ *
+ * Placement is a best fit lookup in the tracking, then mapped with MAP_FIXED_NOREPLACE.
+ * If something the tracking doesn't know about is in the way, the pages it covers are found by bisecting the range
+ * with placeholders. Only those are written off, until the guest unmaps them, and the next fit is tried.
+ *
+ * Once the window is tracked, every guest mmap, munmap and mremap goes through here to keep it in sync.
+ *
+ * Like the 32bit allocator, all calls return -errno on failure.
+ */
+class Map32BitAllocator final {
+public:
+  void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset);
+  int munmap(void *addr, size_t length);
+  void *mremap(void *old_address, size_t old_size, size_t new_size, int flags, void *new_address);
+
+  // x86-64 Linux places MAP_32BIT mappings in the second gigabyte
+  static constexpr uint64_t WINDOW_BASE = 0x4000'0000ULL;
+  static constexpr uint64_t WINDOW_END  = 0x8000'0000ULL;
+
+private:
+  static constexpr uint64_t PAGE_SHIFT = 12;
+  static constexpr uint64_t PAGE_SIZE = 1 << PAGE_SHIFT;
+  static constexpr uint64_t PAGE_MASK = PAGE_SIZE - 1;
+  static constexpr uint64_t BASE_PAGE = WINDOW_BASE >> PAGE_SHIFT;
+  static constexpr uint64_t END_PAGE = WINDOW_END >> PAGE_SHIFT;
+
+  void TrackWindow();
+  // What MAP_32BIT did before the window, hint low and hope the kernel finds space under 4GB
+  void *MapLowHint(size_t length, int prot, int flags, int fd, off_t offset);
+  // Maps a PROT_NONE placeholder over pages, returns an errno value, EEXIST if anything is already there
+  int ReservePages(uint64_t Page, uint64_t Pages);
+  // Hands back pages claimed for a placement that failed with EEXIST, keeping only the occupied ones claimed
+  void WriteOffOccupiedPages(uint64_t Page, uint64_t Pages);
+  // Bisects with placeholders and claims each occupied page, returns false if none were found
+  bool ClaimOccupiedPages(uint64_t Page, uint64_t Pages);
+
+  // Clamps [Page, Page + Pages) to the window, returns false if they don't overlap
+  static bool ClampToWindow(uint64_t &Page, uint64_t &Pages);
+
+  std::mutex AllocMutex{};
+  std::atomic<bool> WindowTracked{};
+  // Set if the kernel can't do MAP_FIXED_NOREPLACE, MAP_32BIT then falls back to a low hint
+  bool WindowUnavailable{};
+
+  FreePageRanges Free{};
+};
+}
@@ -29,57 +29,47 @@ static std::string get_fdpath(int fd)
 namespace FEX::HLE::x64 {
   void RegisterMemory(FEX::HLE::SyscallHandler *const Handler) {
     REGISTER_SYSCALL_IMPL_X64(munmap, [](FEXCore::Core::CpuStateFrame *Frame, void *addr, size_t length) -> uint64_t {
-      uint64_t Result = FEXCore::Allocator::munmap(addr, length);
+      auto Result = static_cast<FEX::HLE::x64::x64SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+        munmap(addr, length);
 
       auto Thread = Frame->Thread;
-      if (Result != -1) {
+      if (Result == 0) {
         FEXCore::Context::RemoveNamedRegion(Thread->CTX, (uintptr_t)addr, length);
         FEXCore::Context::FlushCodeRange(Thread, (uintptr_t)addr, length);
+        FEXCore::Context::NotifyGuestMappingChanged(Thread->CTX, (uintptr_t)addr, length);
       }
-      SYSCALL_ERRNO();
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X64(mmap, [](FEXCore::Core::CpuStateFrame *Frame, void *addr, size_t length, int prot, int flags, int fd, off_t offset) -> uint64_t {
       static FEX_CONFIG_OPT(AOTIRLoad, AOTIRLOAD);
 
-#ifdef _M_ARM_64
-      constexpr uint32_t X86_64_MAP_32BIT = 0x40;
-
-      // Handle MAP_32BIT without a full allocator
-      // Set address to a low address to force the kernel to allocate bottom up
-      bool Map32Bit = (flags & X86_64_MAP_32BIT) &&
-          !(flags & (MAP_FIXED | MAP_FIXED_NOREPLACE));
-      if (Map32Bit) {
-        addr = reinterpret_cast<void*>(0x1'0000);
-        // Remove the flag
-        flags &= ~X86_64_MAP_32BIT;
-      }
-#endif
-      uint64_t Result = reinterpret_cast<uint64_t>(FEXCore::Allocator::mmap(addr, length, prot, flags, fd, offset));
+      // MAP_32BIT is handled by the allocator on hosts that don't have it
+      auto Result = reinterpret_cast<uint64_t>(static_cast<FEX::HLE::x64::x64SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+        mmap(addr, length, prot, flags, fd, offset));
 
       auto Thread = Frame->Thread;
-      if (Result != -1) {
-#ifdef _M_ARM_64
-        if (Map32Bit) {
-          if ((Result + length) >= 0x1'0000'0000ULL) {
-            FEXCore::Allocator::munmap(reinterpret_cast<void*>(Result), length);
-            return -ENOMEM;
-          }
-        }
-#endif
+      if (Result < -4096) {
         if (!(flags & MAP_ANONYMOUS)) {
           auto filename = get_fdpath(fd);
 
           FEXCore::Context::AddNamedRegion(Thread->CTX, Result, length, offset, filename);
         }
         FEXCore::Context::FlushCodeRange(Thread, (uintptr_t)Result, length);
+        FEXCore::Context::NotifyGuestMappingChanged(Thread->CTX, Result, length);
       }
-      SYSCALL_ERRNO();
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X64(mremap, [](FEXCore::Core::CpuStateFrame *Frame, void *old_address, size_t old_size, size_t new_size, int flags, void *new_address) -> uint64_t {
-      uint64_t Result = reinterpret_cast<uint64_t>(::mremap(old_address, old_size, new_size, flags, new_address));
-      SYSCALL_ERRNO();
+      auto Result = reinterpret_cast<uint64_t>(static_cast<FEX::HLE::x64::x64SyscallHandler*>(FEX::HLE::_SyscallHandler)->GetAllocator()->
+        mremap(old_address, old_size, new_size, flags, new_address));
+
+      if (Result < -4096) {
+        FEXCore::Context::NotifyGuestMappingChanged(Frame->Thread->CTX, (uintptr_t)old_address, old_size);
+        FEXCore::Context::NotifyGuestMappingChanged(Frame->Thread->CTX, Result, new_size);
+      }
+      return Result;
     });
 
     REGISTER_SYSCALL_IMPL_X64(mprotect, [](FEXCore::Core::CpuStateFrame *Frame, void *addr, size_t len, int prot) -> uint64_t {
@@ -89,6 +79,9 @@ namespace FEX::HLE::x64 {
       if (Result != -1 && prot & PROT_EXEC) {
         FEXCore::Context::FlushCodeRange(Thread, (uintptr_t)addr, len);
       }
+      if (Result != -1) {
+        FEXCore::Context::NotifyGuestMappingChanged(Thread->CTX, (uintptr_t)addr, len);
+      }
       SYSCALL_ERRNO();
     });
 
@@ -66,14 +66,6 @@ namespace FEX::HLE::x64 {
       });
   }
 
-  class x64SyscallHandler final : public FEX::HLE::SyscallHandler {
-  public:
-    x64SyscallHandler(FEXCore::Context::Context *ctx, FEX::HLE::SignalDelegator *_SignalDelegation);
-
-  private:
-    void RegisterSyscallHandlers();
-  };
-
   x64SyscallHandler::x64SyscallHandler(FEXCore::Context::Context *ctx, FEX::HLE::SignalDelegator *_SignalDelegation)
     : SyscallHandler {ctx, _SignalDelegation} {
     OSABI = FEXCore::HLE::SyscallOSABI::OS_LINUX64;
@@ -149,6 +141,16 @@ namespace FEX::HLE::x64 {
 #endif
     }
 
+    // These don't block, the host mask can keep trailing the guest's through them
+    for (auto Syscall : {
+      SYSCALL_x64_rt_sigaction,
+      SYSCALL_x64_rt_sigprocmask,
+      SYSCALL_x64_rt_sigpending,
+      SYSCALL_x64_sigaltstack,
+    }) {
+      Definitions.at(Syscall).SkipHostMaskSync = true;
+    }
+
 #if PRINT_MISSING_SYSCALLS
     for (auto &Syscall: SyscallNames) {
       if (Definitions[Syscall.first].Ptr == cvt(&UnimplementedSyscall)) {
@@ -7,6 +7,8 @@ $end_info$
 #pragma once
 
 #include "Tests/LinuxSyscalls/FileManagement.h"
+#include "Tests/LinuxSyscalls/Syscalls.h"
+#include "Tests/LinuxSyscalls/x64/Map32BitAllocator.h"
 #include <FEXCore/HLE/SyscallHandler.h>
 
 #include <atomic>
@@ -27,6 +29,17 @@ struct InternalThreadState;
 namespace FEX::HLE::x64 {
 #include "SyscallsEnum.h"
 
+class x64SyscallHandler final : public FEX::HLE::SyscallHandler {
+public:
+  x64SyscallHandler(FEXCore::Context::Context *ctx, FEX::HLE::SignalDelegator *_SignalDelegation);
+
+  FEX::HLE::x64::Map32BitAllocator *GetAllocator() { return &AllocHandler; }
+
+private:
+  void RegisterSyscallHandlers();
+  FEX::HLE::x64::Map32BitAllocator AllocHandler{};
+};
+
 std::unique_ptr<FEX::HLE::SyscallHandler> CreateHandler(FEXCore::Context::Context *ctx, FEX::HLE::SignalDelegator *_SignalDelegation);
 
 void RegisterSyscallInternal(int SyscallNumber,
@@ -20,7 +20,7 @@ $end_info$
 namespace FEX::HLE::x64 {
   void RegisterTime() {
     REGISTER_SYSCALL_IMPL_X64(gettimeofday, [](FEXCore::Core::CpuStateFrame *Frame, struct timeval *tv, struct timezone *tz) -> uint64_t {
-      uint64_t Result = ::gettimeofday(tv, tz);
+      uint64_t Result = FEX::HLE::_SyscallHandler->GetTimeOfDay(Frame, tv, tz);
       SYSCALL_ERRNO();
     });
 
@@ -30,7 +30,7 @@ namespace FEX::HLE::x64 {
     });
 
     REGISTER_SYSCALL_IMPL_X64(clock_gettime, [](FEXCore::Core::CpuStateFrame *Frame, clockid_t clk_id, struct timespec *tp) -> uint64_t {
-      uint64_t Result = ::clock_gettime(clk_id, tp);
+      uint64_t Result = FEX::HLE::_SyscallHandler->ClockGetTime(Frame, clk_id, tp);
       SYSCALL_ERRNO();
     });
 
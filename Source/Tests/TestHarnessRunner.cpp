@@ -25,8 +25,11 @@ $end_info$
 #include <FEXCore/Utils/LogManager.h>
 
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
@@ -129,13 +132,78 @@ int main(int argc, char **argv, char **const envp) {
   if (!Result1)
     return 1;
 
+  // Stands in for a debugger. Only the first breakpoint is armed, each stop has to be at the armed one,
+  // which is then swapped for the next so adding and removing both have to invalidate compiled code
+  const auto Breakpoints = Loader.GetBreakpoints();
+  size_t BreakpointsHit{};
+  bool BreakpointMismatch{};
+  std::mutex DebugMutex;
+  std::condition_variable DebugCV;
+  bool DebugStopped{};
+  bool DebugShutdown{};
+  std::thread DebugThread;
+
+  if (!Breakpoints.empty()) {
+    FEXCore::Context::AddBreakpoint(CTX, Breakpoints[0]);
+
+    // The stopped thread can't resume itself, so the debugger thread does it
+    FEXCore::Context::SetExitHandler(CTX, [&](uint64_t ThreadId, FEXCore::Context::ExitReason Reason) {
+      if (Reason == FEXCore::Context::ExitReason::EXIT_DEBUG) {
+        std::lock_guard lk(DebugMutex);
+        DebugStopped = true;
+        DebugCV.notify_one();
+      }
+    });
+
+    DebugThread = std::thread([&]() {
+      std::unique_lock lk(DebugMutex);
+      for (;;) {
+        DebugCV.wait(lk, [&]() { return DebugStopped || DebugShutdown; });
+        if (!DebugStopped) {
+          return;
+        }
+        DebugStopped = false;
+
+        FEXCore::Core::CPUState State;
+        FEXCore::Context::GetCPUState(CTX, &State);
+        if (BreakpointsHit == Breakpoints.size() || State.rip != Breakpoints[BreakpointsHit]) {
+          LogMan::Msg::E("Unexpected debug stop at 0x%lx", State.rip);
+          BreakpointMismatch = true;
+        }
+        else {
+          FEXCore::Context::RemoveBreakpoint(CTX, Breakpoints[BreakpointsHit]);
+          ++BreakpointsHit;
+          if (BreakpointsHit < Breakpoints.size()) {
+            FEXCore::Context::AddBreakpoint(CTX, Breakpoints[BreakpointsHit]);
+          }
+        }
+
+        FEXCore::Context::Run(CTX);
+      }
+    });
+  }
+
   FEXCore::Context::RunUntilExit(CTX);
 
+  if (DebugThread.joinable()) {
+    {
+      std::lock_guard lk(DebugMutex);
+      DebugShutdown = true;
+      DebugCV.notify_one();
+    }
+    DebugThread.join();
+  }
+
   // Just re-use compare state. It also checks against the expected values in config.
   FEXCore::Core::CPUState State;
   FEXCore::Context::GetCPUState(CTX, &State);
   bool Passed = !DidFault && Loader.CompareStates(&State, nullptr);
 
+  if (!Breakpoints.empty()) {
+    LogMan::Msg::I("Breakpoints hit: %ld of %ld", BreakpointsHit, Breakpoints.size());
+    Passed &= !BreakpointMismatch && BreakpointsHit == Breakpoints.size();
+  }
+
   LogMan::Msg::I("Faulted? %s", DidFault ? "Yes" : "No");
   LogMan::Msg::I("Passed? %s", Passed ? "Yes" : "No");
 
@@ -0,0 +1,85 @@
+#include "Tests/LinuxSyscalls/x64/Map32BitAllocator.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#define CHECK(Cond) \
+  do { \
+    if (!(Cond)) { \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Cond); \
+      exit(1); \
+    } \
+  } while (0)
+
+using FEX::HLE::x64::FreePageRanges;
+
+static void BestFit() {
+  FreePageRanges Free;
+  Free.ReleaseRange(0x100, 16);
+  Free.ReleaseRange(0x200, 4);
+  Free.ReleaseRange(0x300, 8);
+
+  // Smallest range that fits, not the first
+  CHECK(Free.AllocateRange(4) == 0x200);
+  CHECK(Free.AllocateRange(5) == 0x300);
+  // What is left of a range is still usable
+  CHECK(Free.AllocateRange(3) == 0x305);
+  CHECK(Free.AllocateRange(16) == 0x100);
+  CHECK(Free.AllocateRange(1) == 0);
+  CHECK(Free.NumRanges() == 0);
+}
+
+static void ReleaseCoalesces() {
+  FreePageRanges Free;
+  Free.ReleaseRange(0x100, 4);
+  Free.ReleaseRange(0x108, 4);
+  CHECK(Free.NumRanges() == 2);
+
+  // Fills the hole, merging with both neighbours
+  Free.ReleaseRange(0x104, 4);
+  CHECK(Free.NumRanges() == 1);
+  CHECK(Free.IsRangeFree(0x100, 12));
+  CHECK(Free.AllocateRange(12) == 0x100);
+
+  // Overlapping releases don't duplicate pages
+  Free.ReleaseRange(0x100, 8);
+  Free.ReleaseRange(0x104, 8);
+  CHECK(Free.NumRanges() == 1);
+  CHECK(Free.IsRangeFree(0x100, 12));
+  CHECK(!Free.IsRangeFree(0x100, 13));
+}
+
+static void ClaimSplits() {
+  FreePageRanges Free;
+  Free.ReleaseRange(0x100, 16);
+
+  // Claiming from the middle leaves both ends free
+  Free.ClaimRange(0x104, 4);
+  CHECK(Free.NumRanges() == 2);
+  CHECK(Free.IsRangeFree(0x100, 4));
+  CHECK(!Free.IsRangeFree(0x104, 1));
+  CHECK(Free.IsRangeFree(0x108, 8));
+
+  // Claiming across ranges and pages that are already in use
+  Free.ClaimRange(0x102, 8);
+  CHECK(Free.NumRanges() == 2);
+  CHECK(Free.IsRangeFree(0x100, 2));
+  CHECK(Free.IsRangeFree(0x10A, 6));
+  CHECK(!Free.IsRangeFree(0x102, 8));
+
+  // Claiming pages that were never free does nothing
+  Free.ClaimRange(0x200, 4);
+  CHECK(Free.NumRanges() == 2);
+
+  // Releasing what was claimed brings back the single range
+  Free.ReleaseRange(0x102, 8);
+  CHECK(Free.NumRanges() == 1);
+  CHECK(Free.IsRangeFree(0x100, 16));
+}
+
+int main() {
+  BestFit();
+  ReleaseCoalesces();
+  ClaimSplits();
+  return 0;
+}
@@ -0,0 +1,46 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R8":  "0x2468acf13579be02",
+    "R9":  "0x2",
+    "R10": "0x197c790f3f086b68",
+    "R11": "0x0",
+    "R12": "0x413ea6",
+    "R13": "0x228",
+    "RAX": "0x4d541894a7",
+    "RDX": "0x3aea07ef"
+  }
+}
+%endif
+
+; 64bit divide by a constant that needs the add fixup
+mov rax, 0xFEDCBA9876543210
+xor edx, edx
+mov rcx, 7
+div rcx
+mov r8, rax
+mov r9, rdx
+
+; 64bit divide by a constant with a plain multiply-high
+mov rax, 0xFEDCBA9876543210
+xor edx, edx
+mov rcx, 10
+div rcx
+mov r10, rax
+mov r11, rdx
+
+; 32bit divide by a constant
+mov eax, 0xFEDCBA98
+xor edx, edx
+mov ecx, 1000
+div ecx
+mov r12, rax
+mov r13, rdx
+
+; 128bit dividend with a divisor that fits in 32bits
+mov rax, 0x0123456789ABCDEF
+mov rdx, 0x12
+mov rcx, 0x3B9ACA00
+div rcx
+
+hlt
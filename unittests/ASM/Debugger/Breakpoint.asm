@@ -0,0 +1,33 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "3",
+    "RBX": "3",
+    "RCX": "0"
+  },
+  "Breakpoints": ["0x10040", "0x10020"]
+}
+%endif
+
+; The second breakpoint lands on a block that already ran, so it only stops if the cached code was thrown away.
+; The first one is mid block, which needs the block split there.
+mov rcx, 3
+mov rax, 0
+mov rbx, 0
+jmp loop_top
+
+align 0x20, int3
+loop_top:
+; 0x10020
+add rax, 1
+nop
+nop
+
+align 0x40, nop
+; 0x10040
+add rbx, 1
+dec rcx
+jnz loop_top
+
+hlt
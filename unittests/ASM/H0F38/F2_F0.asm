@@ -0,0 +1,29 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R15": "0x6620e9dd",
+    "R14": "0x30f17de7",
+    "R13": "0xe8969a75"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+
+; The upper half of the accumulator is ignored and cleared
+mov r15, 0xDEADBEEFFFFFFFFF
+mov r14, 0x12345678
+mov r13, 0xDEADBEEF87654321
+mov rbx, 0x5A
+
+crc32 r15d, al
+crc32 r14d, byte [rdx + 8 * 0]
+crc32 r13, bl
+
+hlt
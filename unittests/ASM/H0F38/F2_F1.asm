@@ -0,0 +1,33 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R15": "0xf92cf4c6",
+    "R14": "0xf6511013",
+    "R13": "0x524b0468",
+    "R12": "0xc0c211bb"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8 * 1], rax
+
+; The upper half of the accumulator is ignored and cleared
+mov r15, 0xDEADBEEFFFFFFFFF
+mov r14, 0x12345678
+mov r13, 0xDEADBEEFFFFFFFFF
+mov r12, 0
+
+crc32 r15d, word [rdx + 8 * 0]
+crc32 r14d, dword [rdx + 8 * 0]
+crc32 r13, qword [rdx + 8 * 0]
+crc32 r12, qword [rdx + 8 * 1]
+
+hlt
@@ -0,0 +1,30 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM1": ["0x9BFD5731F970E861", "0x7513B9DFFD9B3157"],
+    "XMM2": ["0x9BFD5731F970E861", "0x7513B9DFFD9B3157"],
+    "XMM3": ["0x8899AABBCCDDEEFF", "0x0011223344556677"]
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x0123456789ABCDEF
+mov [rdx + 8 * 0], rax
+mov rax, 0xFEDCBA9876543210
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x8899AABBCCDDEEFF
+mov [rdx + 8 * 2], rax
+mov rax, 0x0011223344556677
+mov [rdx + 8 * 3], rax
+
+movaps xmm1, [rdx + 8 * 0]
+movaps xmm2, [rdx + 8 * 0]
+movaps xmm3, [rdx + 8 * 2]
+
+sha1msg2 xmm1, xmm3
+sha1msg2 xmm2, [rdx + 8 * 2]
+
+hlt
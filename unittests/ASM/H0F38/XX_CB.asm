@@ -0,0 +1,37 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM0": ["0x428A2F9871374491", "0xB5C0FBCFE9B5DBA5"],
+    "XMM1": ["0xD9597976F0795CEA", "0x41C7828D538ED112"],
+    "XMM2": ["0xD9597976F0795CEA", "0x41C7828D538ED112"],
+    "XMM3": ["0x8899AABBCCDDEEFF", "0x0011223344556677"]
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x0123456789ABCDEF
+mov [rdx + 8 * 0], rax
+mov rax, 0xFEDCBA9876543210
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x8899AABBCCDDEEFF
+mov [rdx + 8 * 2], rax
+mov rax, 0x0011223344556677
+mov [rdx + 8 * 3], rax
+
+mov rax, 0x428A2F9871374491
+mov [rdx + 8 * 4], rax
+mov rax, 0xB5C0FBCFE9B5DBA5
+mov [rdx + 8 * 5], rax
+
+movaps xmm0, [rdx + 8 * 4]
+movaps xmm1, [rdx + 8 * 0]
+movaps xmm2, [rdx + 8 * 0]
+movaps xmm3, [rdx + 8 * 2]
+
+sha256rnds2 xmm1, xmm3
+sha256rnds2 xmm2, [rdx + 8 * 2]
+
+hlt
@@ -0,0 +1,36 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM1": ["0x20B813A968B45BA5", "0x0098338948947B85"],
+    "XMM2": ["0x58CF75C02CFF01F0", "0x78EF55E00CDF21D0"],
+    "XMM3": ["0x20203311286C3B5D", "0x00001331084C1B7D"],
+    "XMM4": ["0x202F2D00145F1970", "0x000F0D20347F3950"],
+    "XMM5": ["0x8899AABBCCDDEEFF", "0x0011223344556677"]
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x0123456789ABCDEF
+mov [rdx + 8 * 0], rax
+mov rax, 0xFEDCBA9876543210
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x8899AABBCCDDEEFF
+mov [rdx + 8 * 2], rax
+mov rax, 0x0011223344556677
+mov [rdx + 8 * 3], rax
+
+movaps xmm1, [rdx + 8 * 0]
+movaps xmm2, [rdx + 8 * 0]
+movaps xmm3, [rdx + 8 * 0]
+movaps xmm4, [rdx + 8 * 0]
+movaps xmm5, [rdx + 8 * 2]
+
+pclmulqdq xmm1, xmm5, 0x00
+pclmulqdq xmm2, [rdx + 8 * 2], 0x01
+pclmulqdq xmm3, xmm5, 0x10
+pclmulqdq xmm4, [rdx + 8 * 2], 0x11
+
+hlt
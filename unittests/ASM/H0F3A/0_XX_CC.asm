@@ -0,0 +1,36 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM1": ["0x5044A5CFAFF5AF36", "0x49DAE1FA46297DE9"],
+    "XMM2": ["0xD2CA613AD257C6E2", "0x28ACAE8CC944B2D5"],
+    "XMM3": ["0xFDE83C1C5AF9DDE5", "0x8EFDF54F4CADEA00"],
+    "XMM4": ["0xC5F348722939FC70", "0x47519810D489BF3C"],
+    "XMM5": ["0x8899AABBCCDDEEFF", "0x0011223344556677"]
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x0123456789ABCDEF
+mov [rdx + 8 * 0], rax
+mov rax, 0xFEDCBA9876543210
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x8899AABBCCDDEEFF
+mov [rdx + 8 * 2], rax
+mov rax, 0x0011223344556677
+mov [rdx + 8 * 3], rax
+
+movaps xmm1, [rdx + 8 * 0]
+movaps xmm2, [rdx + 8 * 0]
+movaps xmm3, [rdx + 8 * 0]
+movaps xmm4, [rdx + 8 * 0]
+movaps xmm5, [rdx + 8 * 2]
+
+sha1rnds4 xmm1, xmm5, 0
+sha1rnds4 xmm2, [rdx + 8 * 2], 1
+sha1rnds4 xmm3, xmm5, 2
+sha1rnds4 xmm4, [rdx + 8 * 2], 3
+
+hlt
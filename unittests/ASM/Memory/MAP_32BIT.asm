@@ -0,0 +1,96 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R15": "0x1",
+    "R14": "0x1",
+    "R13": "0xffffffffffffffef",
+    "R12": "0x1",
+    "RBP": "0x1"
+  }
+}
+%endif
+
+; MAP_32BIT lands in the low 2GB
+mov rax, 9 ; mmap
+mov rdi, 0
+mov rsi, 0x2000
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x62 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT
+mov r8, -1
+mov r9, 0
+syscall
+mov rbx, rax
+
+; Errors are huge unsigned values and fail this too
+xor r15, r15
+mov rdx, 0x7fffe000
+cmp rbx, rdx
+setbe r15b
+
+mov qword [rbx], 0x1234
+
+; Unmap the second page, then grow back in to it without moving
+mov rax, 11 ; munmap
+lea rdi, [rbx + 0x1000]
+mov rsi, 0x1000
+syscall
+
+mov rax, 25 ; mremap
+mov rdi, rbx
+mov rsi, 0x1000
+mov rdx, 0x2000
+mov r10, 0
+mov r8, 0
+syscall
+
+xor r14, r14
+cmp rax, rbx
+sete r14b
+mov qword [rbx + 0x1000], 0x5678
+
+; MAP_FIXED_NOREPLACE over the mapping fails with EEXIST
+mov rax, 9 ; mmap
+mov rdi, rbx
+mov rsi, 0x2000
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+mov r13, rax
+
+; Once unmapped it succeeds at the same address
+mov rax, 11 ; munmap
+mov rdi, rbx
+mov rsi, 0x2000
+syscall
+
+mov rax, 9 ; mmap
+mov rdi, rbx
+mov rsi, 0x2000
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x100022 ; MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE
+mov r8, -1
+mov r9, 0
+syscall
+
+xor r12, r12
+cmp rax, rbx
+sete r12b
+
+; A hint on free pages near the MAP_32BIT mappings is honoured
+lea rdi, [rbx + 0x100000]
+mov rax, 9 ; mmap
+mov rsi, 0x1000
+mov rdx, 3 ; PROT_READ | PROT_WRITE
+mov r10, 0x22 ; MAP_PRIVATE | MAP_ANONYMOUS
+mov r8, -1
+mov r9, 0
+syscall
+
+xor rbp, rbp
+lea rdx, [rbx + 0x100000]
+cmp rax, rdx
+sete bpl
+
+hlt
@@ -0,0 +1,66 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R8":  "0x4142434445464748",
+    "R9":  "0x5152535455565758",
+    "R10": "0x5152535455565758",
+    "R11": "0x4142434445464748",
+    "R12": "0x5152535455565758",
+    "R13": "0x4142434445464748",
+    "R14": "0x4142434445464748",
+    "R15": "0x4546474855565758",
+    "RSI": "0x5152535455565758",
+    "RDI": "0x0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov rbx, 0x5152535455565758
+mov [rdx + 8 * 0], rax
+mov [rdx + 8 * 1], rbx
+
+mov rcx, 0
+mov [rdx + 0x20], rcx
+mov [rdx + 0x28], rcx
+mov [rdx + 0x30], rcx
+mov [rdx + 0x38], rcx
+mov [rdx + 0x40], rcx
+mov [rdx + 0x48], rcx
+mov [rdx + 0x50], rcx
+mov [rdx + 0x58], rcx
+mov [rdx + 0x60], rcx
+mov [rdx + 0x68], rcx
+
+movaps xmm0, [rdx + 8 * 0]
+pshufd xmm1, xmm0, 0x4E
+movq mm0, rax
+
+; Both halves of each 16 byte store have to land in the right place
+movntdq [rdx + 0x20], xmm0
+movntdq [rdx + 0x30], xmm1
+movntps [rdx + 0x40], xmm1
+movntq [rdx + 0x50], mm0
+movnti [rdx + 0x58], ebx
+movnti [rdx + 0x5C], eax
+movnti [rdx + 0x60], rbx
+sfence
+
+mov r8,  [rdx + 0x20]
+mov r9,  [rdx + 0x28]
+mov r10, [rdx + 0x30]
+mov r11, [rdx + 0x38]
+mov r12, [rdx + 0x40]
+mov r13, [rdx + 0x48]
+mov r14, [rdx + 0x50]
+mov r15, [rdx + 0x58]
+mov rsi, [rdx + 0x60]
+mov rdi, [rdx + 0x68]
+
+emms
+hlt
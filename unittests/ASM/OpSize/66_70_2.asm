@@ -0,0 +1,54 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM0": ["0x4142434445464748", "0x5152535455565758"],
+    "XMM1": ["0x6162636465666768", "0x7172737475767778"],
+    "XMM2": ["0x4546474841424344", "0x5556575851525354"],
+    "XMM3": ["0x4546474845464748", "0x4142434441424344"],
+    "XMM4": ["0x5556575855565758", "0x5152535451525354"],
+    "XMM5": ["0x5556575845464748", "0x5556575845464748"],
+    "XMM6": ["0x5152535441424344", "0x5152535441424344"],
+    "XMM7": ["0x4546474845464748", "0x5556575855565758"],
+    "XMM8": ["0x4142434441424344", "0x5152535451525354"],
+    "XMM9": ["0x5556575841424344", "0x4546474851525354"],
+    "XMM10": ["0x4546474851525354", "0x5556575841424344"],
+    "XMM11": ["0x4142434445464748", "0x4546474855565758"],
+    "XMM12": ["0x4142434451525354", "0x5556575845464748"],
+    "XMM13": ["0x6162636471727374", "0x7576777865666768"]
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x6162636465666768
+mov [rdx + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [rdx + 8 * 3], rax
+
+movapd xmm0, [rdx]
+movapd xmm1, [rdx + 8 * 2]
+
+; Each immediate picks a different lowering
+pshufd xmm2, xmm0, 0xB1 ; rev64
+pshufd xmm3, xmm0, 0x50 ; zip1
+pshufd xmm4, xmm0, 0xFA ; zip2
+pshufd xmm5, xmm0, 0x88 ; uzp1
+pshufd xmm6, xmm0, 0xDD ; uzp2
+pshufd xmm7, xmm0, 0xA0 ; trn1
+pshufd xmm8, xmm0, 0xF5 ; trn2
+pshufd xmm9, xmm0, 0x39 ; ext
+pshufd xmm10, xmm0, 0x93 ; ext
+pshufd xmm11, xmm0, 0x24 ; single element insert
+pshufd xmm12, xmm0, 0x87 ; tbl
+pshufd xmm13, xmm1, 0x87 ; tbl, same indices from another source
+
+hlt
@@ -0,0 +1,55 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x4600",
+    "RCX": "0x0",
+    "RDI": "0xE0000014",
+    "RSI": "0xE0000114",
+    "R8":  "0x7",
+    "R9":  "0xE0000029",
+    "R10": "0xE0000129",
+    "R11": "0x0200"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+; Two 48 byte strings that differ at index 40
+cld
+lea rdi, [rdx]
+mov rax, 0x41
+mov rcx, 48
+rep stosb
+lea rdi, [rdx + 0x100]
+mov rcx, 48
+rep stosb
+mov byte [rdx + 0x100 + 40], 0x42
+
+; Stops on the mismatch
+lea rdi, [rdx]
+lea rsi, [rdx + 0x100]
+mov rcx, 48
+repe cmpsb
+mov r8, rcx
+mov r9, rdi
+mov r10, rsi
+
+; cmp = 0x42 - 0x41 = 0x1
+mov rax, 0
+lahf
+mov r11, rax
+
+; Runs out of count with everything equal
+lea rdi, [rdx]
+lea rsi, [rdx + 0x100]
+mov rcx, 20
+repe cmpsb
+
+mov rax, 0
+lahf
+
+hlt
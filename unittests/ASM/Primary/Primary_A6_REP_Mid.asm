@@ -0,0 +1,60 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0200",
+    "R8":  "0x20",
+    "R9":  "0xE000000B",
+    "R10": "0xE000010B",
+    "R11": "0x0200",
+    "R12": "0x1A",
+    "R13": "0xE0000019",
+    "R14": "0xE0000119"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+; Two 64 byte strings of 'A'
+cld
+lea rdi, [rdx]
+mov rax, 0x41
+mov rcx, 64
+rep stosb
+lea rdi, [rdx + 0x100]
+mov rcx, 64
+rep stosb
+
+; Unaligned start with the mismatch partway into the first 16 byte chunk
+mov byte [rdx + 0x100 + 3 + 7], 0x42
+lea rdi, [rdx + 3]
+lea rsi, [rdx + 0x100 + 3]
+mov rcx, 40
+repe cmpsb
+mov r8, rcx
+mov r9, rdi
+mov r10, rsi
+
+; cmp = 0x42 - 0x41 = 0x1
+mov rax, 0
+lahf
+mov r11, rax
+
+; Mismatch partway into the second chunk, after a whole chunk was skipped
+mov byte [rdx + 0x100 + 3 + 7], 0x41
+mov byte [rdx + 0x100 + 1 + 23], 0x42
+lea rdi, [rdx + 1]
+lea rsi, [rdx + 0x100 + 1]
+mov rcx, 50
+repe cmpsb
+mov r12, rcx
+mov r13, rdi
+mov r14, rsi
+
+mov rax, 0
+lahf
+
+hlt
@@ -0,0 +1,45 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0200",
+    "R8":  "0x3E",
+    "R9":  "0xE0000026",
+    "R10": "0x0",
+    "R11": "0xE000001E"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+; Fill 64 bytes with 'A' and place one 'a' past the first few 16 byte chunks
+cld
+lea rdi, [rdx]
+mov rax, 0x41
+mov rcx, 64
+rep stosb
+mov byte [rdx + 37], 0x61
+
+; Stops on the match
+lea rdi, [rdx]
+mov rax, 0x61
+mov rcx, 100
+repne scasb
+mov r8, rcx
+mov r9, rdi
+
+; Runs out of count without a match, flags come from the last element
+lea rdi, [rdx]
+mov rcx, 30
+repne scasb
+mov r10, rcx
+mov r11, rdi
+
+; cmp = 0x61 - 0x41 = 0x20
+mov rax, 0
+lahf
+
+hlt
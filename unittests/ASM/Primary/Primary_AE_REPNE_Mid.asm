@@ -0,0 +1,47 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x4600",
+    "R8":  "0x28",
+    "R9":  "0xE000000F",
+    "R10": "0x14",
+    "R11": "0xE0000021"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+; Fill 64 bytes with 'A'
+cld
+lea rdi, [rdx]
+mov rax, 0x41
+mov rcx, 64
+rep stosb
+
+; Unaligned start with the match partway into the first 16 byte chunk
+mov byte [rdx + 5 + 9], 0x61
+lea rdi, [rdx + 5]
+mov rax, 0x61
+mov rcx, 50
+repne scasb
+mov r8, rcx
+mov r9, rdi
+
+; Match partway into the second chunk, after a whole chunk was skipped
+mov byte [rdx + 5 + 9], 0x41
+mov byte [rdx + 2 + 30], 0x61
+lea rdi, [rdx + 2]
+mov rcx, 51
+repne scasb
+mov r10, rcx
+mov r11, rdi
+
+; cmp = 0x61 - 0x61 = 0
+mov rax, 0
+lahf
+
+hlt
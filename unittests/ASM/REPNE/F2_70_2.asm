@@ -0,0 +1,38 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM0": ["0x4142434445464748", "0x5152535455565758"],
+    "XMM1": ["0x6162636465666768", "0x7172737475767778"],
+    "XMM2": ["0x4142434445464546", "0x5152535455565758"],
+    "XMM3": ["0x4546474845464748", "0x5152535455565758"],
+    "XMM4": ["0x4748454643444142", "0x5152535455565758"],
+    "XMM5": ["0x4344414247484546", "0x5152535455565758"]
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x6162636465666768
+mov [rdx + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [rdx + 8 * 3], rax
+
+movapd xmm0, [rdx]
+movapd xmm1, [rdx + 8 * 2]
+
+; Each immediate picks a different lowering
+pshuflw xmm2, xmm0, 0xE5 ; single element insert
+pshuflw xmm3, xmm0, 0x44 ; single element insert of a 32bit element
+pshuflw xmm4, xmm0, 0x1B ; tbl
+pshuflw xmm5, xmm0, 0xB1 ; tbl
+
+hlt
@@ -0,0 +1,31 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R15": "0x1",
+    "R14": "0x1",
+    "R13": "0x0"
+  }
+}
+%endif
+
+; The value is random, only check what is guaranteed
+mov rax, -1
+mov r14, 0
+rdrand rax
+
+; ZF is always cleared
+setnz r14b
+
+; A failed read returns zero
+setc cl
+test rax, rax
+setz dl
+or cl, dl
+movzx r15, cl
+
+; The 32bit form zero extends
+mov r13, -1
+rdrand r13d
+shr r13, 32
+
+hlt
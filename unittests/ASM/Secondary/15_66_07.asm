@@ -0,0 +1,35 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x4142434445464748",
+    "RBX": "0x5152535455565758",
+    "RCX": "0x6162636465666768"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8 * 8], rax
+
+; CLFLUSHOPT, both from the start and the middle of a line
+clflushopt [rdx]
+clflushopt [rdx + 0x47]
+
+; Stores after the flush still have to be visible
+mov rax, 0x6162636465666768
+mov [rdx + 8 * 9], rax
+clflushopt [rdx + 8 * 9]
+sfence
+
+mov rax, [rdx + 8 * 0]
+mov rbx, [rdx + 8 * 8]
+mov rcx, [rdx + 8 * 9]
+
+hlt
@@ -0,0 +1,50 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x4142434445464748",
+    "RBX": "0x5152535455565758",
+    "RCX": "0x6162636465666768"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; Arg 1 = modrm reg field
+; Always uses [rdx]
+%macro prefetch_p 1
+  db 0x0F
+  db 0x0D
+  db (%1 << 3) | 2
+%endmacro
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+
+; PREFETCHW (/1), PREFETCHWT1 (/2) and AMD's PREFETCHW alias (/3)
+prefetchw [rdx]
+prefetch_p 1
+prefetch_p 2
+prefetch_p 3
+prefetchwt1 [rdx + 8]
+
+mov rbx, 0x5152535455565758
+mov [rdx + 8 * 1], rbx
+
+; Prefetches never fault, even when nothing is mapped
+mov rsi, 0x1000
+prefetchw [rsi]
+prefetchwt1 [rsi + 0x40]
+
+mov rcx, 0x6162636465666768
+mov [rdx + 8 * 2], rcx
+prefetchwt1 [rdx + 8 * 2]
+
+mov rax, [rdx + 8 * 0]
+mov rbx, [rdx + 8 * 1]
+mov rcx, [rdx + 8 * 2]
+
+hlt
@@ -0,0 +1,118 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R12": "0x0",
+    "R13": "0x0",
+    "R14": "0x2200",
+    "R15": "0x2"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; Signals the guest has blocked must not interrupt blocking syscalls
+mov rbx, 0xe0000000
+mov qword [rbx], 0
+
+; Handler for SIGUSR1 and SIGALRM
+lea rax, [rel signal_handler]
+mov [rbx + 0x100], rax
+mov qword [rbx + 0x108], 0
+mov qword [rbx + 0x110], 0
+mov qword [rbx + 0x118], 0
+
+mov rax, 13 ; rt_sigaction
+mov rdi, 14 ; SIGALRM
+lea rsi, [rbx + 0x100]
+mov rdx, 0
+mov r10, 8
+syscall
+
+mov rax, 13 ; rt_sigaction
+mov rdi, 10 ; SIGUSR1
+lea rsi, [rbx + 0x100]
+mov rdx, 0
+mov r10, 8
+syscall
+
+; Block both
+mov qword [rbx + 0x700], 0x2200
+mov rax, 14 ; rt_sigprocmask
+mov rdi, 0 ; SIG_BLOCK
+lea rsi, [rbx + 0x700]
+mov rdx, 0
+mov r10, 8
+syscall
+
+; SIGALRM in 20ms while sleeping for 100ms
+mov qword [rbx + 0x200], 0
+mov qword [rbx + 0x208], 0
+mov qword [rbx + 0x210], 0
+mov qword [rbx + 0x218], 20000
+mov rax, 38 ; setitimer
+mov rdi, 0 ; ITIMER_REAL
+lea rsi, [rbx + 0x200]
+mov rdx, 0
+syscall
+
+mov qword [rbx + 0x300], 0
+mov qword [rbx + 0x308], 100000000
+mov rax, 35 ; nanosleep
+lea rdi, [rbx + 0x300]
+mov rsi, 0
+syscall
+mov r12, rax
+
+; SIGUSR1 from a timer in 20ms while polling for 100ms
+mov qword [rbx + 0x400], 0
+mov dword [rbx + 0x408], 10 ; sigev_signo = SIGUSR1
+mov dword [rbx + 0x40C], 0 ; sigev_notify = SIGEV_SIGNAL
+mov rax, 222 ; timer_create
+mov rdi, 1 ; CLOCK_MONOTONIC
+lea rsi, [rbx + 0x400]
+lea rdx, [rbx + 0x500]
+syscall
+
+mov qword [rbx + 0x600], 0
+mov qword [rbx + 0x608], 0
+mov qword [rbx + 0x610], 0
+mov qword [rbx + 0x618], 20000000
+mov rax, 223 ; timer_settime
+mov edi, dword [rbx + 0x500]
+mov rsi, 0
+lea rdx, [rbx + 0x600]
+mov r10, 0
+syscall
+
+mov rax, 7 ; poll
+mov rdi, 0
+mov rsi, 0
+mov rdx, 100
+syscall
+mov r13, rax
+
+; Both are still pending
+mov qword [rbx + 0x708], 0
+mov rax, 127 ; rt_sigpending
+lea rdi, [rbx + 0x708]
+mov rsi, 8
+syscall
+mov r14, [rbx + 0x708]
+
+; Unblocking delivers both
+mov rax, 14 ; rt_sigprocmask
+mov rdi, 1 ; SIG_UNBLOCK
+lea rsi, [rbx + 0x700]
+mov rdx, 0
+mov r10, 8
+syscall
+
+mov r15, [rbx]
+hlt
+
+signal_handler:
+mov rax, 0xe0000000
+add qword [rax], 1
+ret
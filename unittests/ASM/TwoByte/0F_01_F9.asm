@@ -0,0 +1,30 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x1"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov r15, 0xe0000000
+
+mov rax, 0x0
+mov [r15 + 8 * 0], rax
+
+; RDTSCP must read the same counter as RDTSC, so it can't be behind it
+rdtsc
+shl rdx, 32
+or rax, rdx
+mov rbx, rax
+
+rdtscp
+shl rdx, 32
+or rax, rdx
+cmp rax, rbx
+setae [r15 + 8 * 0]
+mov rax, [r15 + 8 * 0]
+
+hlt
@@ -0,0 +1,48 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM0": ["0x4142434445464748", "0x5152535455565758"],
+    "XMM1": ["0x6162636465666768", "0x7172737475767778"],
+    "XMM2": ["0x5556575845464748", "0x7576777865666768"],
+    "XMM3": ["0x5152535441424344", "0x7172737461626364"],
+    "XMM4": ["0x5152535455565758", "0x6162636465666768"],
+    "XMM5": ["0x4142434445464748", "0x7172737475767778"],
+    "XMM6": ["0x4142434445464748", "0x6162636465666768"],
+    "XMM7": ["0x4546474841424344", "0x6566676865666768"]
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8 * 1], rax
+
+mov rax, 0x6162636465666768
+mov [rdx + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [rdx + 8 * 3], rax
+
+movapd xmm0, [rdx]
+movapd xmm1, [rdx + 8 * 2]
+
+; Each immediate picks a different lowering
+movaps xmm2, xmm0
+shufps xmm2, xmm1, 0x88 ; uzp1
+movaps xmm3, xmm0
+shufps xmm3, xmm1, 0xDD ; uzp2
+movaps xmm4, xmm0
+shufps xmm4, xmm1, 0x4E ; ext on 64bit elements
+movaps xmm5, xmm0
+shufps xmm5, xmm1, 0xE4 ; single element insert of a 64bit element
+movaps xmm6, xmm0
+shufps xmm6, xmm1, 0x44 ; zip1 on 64bit elements
+movaps xmm7, xmm0
+shufps xmm7, xmm1, 0x01 ; mixed sources, element by element
+
+hlt